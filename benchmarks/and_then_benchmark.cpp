@@ -0,0 +1,96 @@
+#include <absent/and_then.h>
+#include <absent/fuse.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+template <std::size_t Depth, typename Nullable, typename UnaryFunction>
+auto and_then_chain(Nullable &&input, UnaryFunction const &step) {
+    if constexpr (Depth == 1) {
+        return std::forward<Nullable>(input) >> step;
+    } else {
+        return and_then_chain<Depth - 1>(std::forward<Nullable>(input) >> step, step);
+    }
+}
+
+template <std::size_t Depth, typename Pipeline, typename UnaryFunction>
+constexpr auto and_then_pipeline(Pipeline pipeline, UnaryFunction const &step) {
+    if constexpr (Depth == 0) {
+        return pipeline;
+    } else {
+        return and_then_pipeline<Depth - 1>(std::move(pipeline) >> step, step);
+    }
+}
+
+template <std::size_t Depth, typename Payload, typename UnaryFunction>
+auto hand_written_and_then(std::optional<Payload> const &input, UnaryFunction const &step) -> std::optional<Payload> {
+    if (!input) {
+        return std::nullopt;
+    }
+    auto output = step(*input);
+    for (std::size_t i = 1; i < Depth; ++i) {
+        if (!output) {
+            return std::nullopt;
+        }
+        output = step(std::move(*output));
+    }
+    return output;
+}
+
+template <typename Payload>
+auto checksum(std::optional<Payload> const &output) -> std::size_t {
+    return output ? payload_traits<Payload>::checksum(*output) : 0;
+}
+
+template <std::size_t Depth, typename Payload>
+void benchmark_and_then(int empty_rate) {
+    auto const inputs = make_optionals<Payload>(empty_rate);
+    auto const step = [](Payload value) {
+        return std::optional<Payload>{payload_traits<Payload>::step(std::move(value))};
+    };
+    auto const pipeline = and_then_pipeline<Depth>(fuse(), step);
+    auto const payload = payload_traits<Payload>::name;
+
+    BENCHMARK(name_of("and_then", "absent", payload, Depth, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += checksum(and_then_chain<Depth>(input, step));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("and_then", "absent-fused", payload, Depth, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += checksum(input | pipeline);
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("and_then", "hand-written", payload, Depth, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += checksum(hand_written_and_then<Depth>(input, step));
+        }
+        return sum;
+    };
+}
+
+}
+
+TEMPLATE_TEST_CASE("and_then against hand-written code for optional<A>", "[and_then]", int, pod64, heap) {
+    auto const empty_rate = GENERATE(from_range(empty_rates));
+    benchmark_and_then<1, TestType>(empty_rate);
+    benchmark_and_then<4, TestType>(empty_rate);
+    benchmark_and_then<8, TestType>(empty_rate);
+}
@@ -0,0 +1,59 @@
+#include <absent/attempt.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+template <typename Payload>
+auto make_or_throw(std::size_t i, int empty_rate) -> Payload {
+    if (is_empty_at(i, empty_rate)) {
+        throw std::runtime_error{"empty"};
+    }
+    return payload_traits<Payload>::make(i);
+}
+
+template <typename Payload>
+auto checksum(std::optional<Payload> const &output) -> std::size_t {
+    return output ? payload_traits<Payload>::checksum(*output) : 0;
+}
+
+template <typename Payload>
+void benchmark_attempt(int empty_rate) {
+    auto const payload = payload_traits<Payload>::name;
+
+    BENCHMARK(name_of("attempt", "absent", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < batch_size; ++i) {
+            sum += checksum(attempt([i, empty_rate] { return make_or_throw<Payload>(i, empty_rate); }));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("attempt", "hand-written", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < batch_size; ++i) {
+            auto output = std::optional<Payload>{};
+            try {
+                output = make_or_throw<Payload>(i, empty_rate);
+            } catch (std::exception const &) {
+            }
+            sum += checksum(output);
+        }
+        return sum;
+    };
+}
+
+}
+
+TEMPLATE_TEST_CASE("attempt against hand-written code for optional<A>", "[attempt]", int, pod64, heap) {
+    benchmark_attempt<TestType>(GENERATE(from_range(empty_rates)));
+}
@@ -0,0 +1,99 @@
+#include <absent/batch.h>
+
+#include "payload.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef RVARAGO_ABSENT_BENCHMARKS_HAS_TBB
+#include <tbb/global_control.h>
+#endif
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+constexpr std::size_t batch_elements = 1 << 16;
+
+/**
+ * A deliberately expensive mapping function, so that the speedup reflects the parallelization rather than the memory
+ * bandwidth.
+ */
+auto expensive_step(int value) -> int {
+    for (int i = 0; i < 256; ++i) {
+        value = value * 1664525 + 1013904223;
+    }
+    return value;
+}
+
+/**
+ * Limits the number of worker threads, when the parallel algorithms are backed by TBB.
+ */
+auto limit_threads(std::size_t threads) {
+#ifdef RVARAGO_ABSENT_BENCHMARKS_HAS_TBB
+    return tbb::global_control{tbb::global_control::max_allowed_parallelism, threads};
+#else
+    return threads;
+#endif
+}
+
+/**
+ * The numbers of threads to run with, or only 0, i.e. the default one, when they can't be limited without TBB, rather
+ * than several runs labelled by different numbers of threads that are all the same configuration.
+ */
+auto thread_counts() -> std::vector<std::size_t> {
+#ifdef RVARAGO_ABSENT_BENCHMARKS_HAS_TBB
+    auto counts = std::vector<std::size_t>{};
+    auto const hardware = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads < hardware; threads *= 2) {
+        counts.push_back(threads);
+    }
+    counts.push_back(hardware);
+    return counts;
+#else
+    return {0};
+#endif
+}
+
+}
+
+TEST_CASE("batch transform scaling with the number of threads for optional<A>", "[batch]") {
+    auto const empty_rate = GENERATE(from_range(empty_rates));
+
+    auto inputs = std::vector<std::optional<int>>{};
+    inputs.reserve(batch_elements);
+    for (std::size_t i = 0; i < batch_elements; ++i) {
+        inputs.push_back(is_empty_at(i, empty_rate) ? std::nullopt : std::optional{static_cast<int>(i)});
+    }
+    auto outputs = std::vector<std::optional<int>>(inputs.size());
+
+    auto const name = [empty_rate](std::string const &implementation) {
+        return "batch-transform/" + implementation + "/empty=" + std::to_string(empty_rate) + "%";
+    };
+
+    BENCHMARK(name("seq")) {
+        return transform(std::execution::seq, inputs, outputs, expensive_step);
+    };
+
+    for (auto const threads : thread_counts()) {
+        [[maybe_unused]] auto const limit = limit_threads(threads);
+
+        auto const label = threads == 0 ? std::string{"default"} : std::to_string(threads);
+
+        BENCHMARK(name("par/threads=" + label)) {
+            return transform(std::execution::par, inputs, outputs, expensive_step);
+        };
+
+        BENCHMARK(name("par_unseq/threads=" + label)) {
+            return transform(std::execution::par_unseq, inputs, outputs, expensive_step);
+        };
+    }
+}
@@ -0,0 +1,96 @@
+#include <absent/eval.h>
+#include <absent/support/compact_optional.h>
+
+#include "payload.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+/**
+ * Large enough for a table of std::optional<int> not to fit in the last-level cache, such that random lookups are
+ * dominated by cache misses.
+ */
+constexpr std::size_t table_size = 1 << 23;
+
+constexpr std::size_t lookups = 1 << 16;
+
+/**
+ * A row of the table, which is never negative, hence it reserves -1 to represent emptiness.
+ */
+using row = support::reserved<int, -1>;
+
+template <typename Nullable>
+auto make_table(int empty_rate) -> std::vector<Nullable> {
+    using Value = typename Nullable::value_type;
+    auto table = std::vector<Nullable>(table_size);
+    for (std::size_t i = 0; i < table_size; ++i) {
+        if (!is_empty_at(i, empty_rate)) {
+            table[i] = Value{static_cast<int>(i)};
+        }
+    }
+    return table;
+}
+
+auto make_random_indexes() -> std::vector<std::uint32_t> {
+    auto indexes = std::vector<std::uint32_t>(lookups);
+    auto engine = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<std::uint32_t>{0, table_size - 1};
+    std::generate(indexes.begin(), indexes.end(), [&] { return distribution(engine); });
+    return indexes;
+}
+
+/**
+ * Builds the name of a benchmark as access/nullable/empty_rate/footprint, e.g.
+ * "lookup/compact_optional<row>/empty=50%/MiB=32".
+ */
+auto name_of(std::string const &access, std::string const &nullable, int empty_rate, std::size_t bytes)
+    -> std::string {
+    return access + "/" + nullable + "/empty=" + std::to_string(empty_rate) +
+           "%/MiB=" + std::to_string(bytes / (1024 * 1024));
+}
+
+template <typename Nullable>
+void benchmark_table(std::string const &nullable, int empty_rate, std::vector<std::uint32_t> const &indexes) {
+    auto const table = make_table<Nullable>(empty_rate);
+    auto const bytes = table.size() * sizeof(Nullable);
+    auto const fallback = [] { return typename Nullable::value_type{0}; };
+
+    BENCHMARK(name_of("scan", nullable, empty_rate, bytes)) {
+        std::size_t sum = 0;
+        for (auto const &entry : table) {
+            sum += static_cast<std::size_t>(eval(entry, fallback));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("lookup", nullable, empty_rate, bytes)) {
+        std::size_t sum = 0;
+        for (auto const index : indexes) {
+            sum += static_cast<std::size_t>(eval(table[index], fallback));
+        }
+        return sum;
+    };
+}
+
+}
+
+TEST_CASE("compact_optional<row> against optional<int> for large tables", "[compact_optional]") {
+    auto const empty_rate = GENERATE(from_range(empty_rates));
+    auto const indexes = make_random_indexes();
+
+    benchmark_table<std::optional<int>>("optional<int>", empty_rate, indexes);
+    benchmark_table<support::compact_optional<row>>("compact_optional<row>", empty_rate, indexes);
+}
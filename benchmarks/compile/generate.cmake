@@ -0,0 +1,35 @@
+# Generates a translation unit with PIPELINES functions, each of them made of a chain of DEPTH stages alternating
+# between transform (operator|) and and_then (operator>>), where every stage is a distinct lambda so that it triggers a
+# distinct instantiation of the combinators.
+#
+# Usage: cmake -DPIPELINES=<n> -DDEPTH=<d> -DOUTPUT=<file> -P generate.cmake
+
+foreach(variable PIPELINES DEPTH OUTPUT)
+    if(NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} must be defined")
+    endif()
+endforeach()
+
+set(content "// Generated by generate.cmake: ${PIPELINES} pipelines of depth ${DEPTH}.\n\n")
+string(APPEND content "#include <absent/absent.h>\n\n#include <optional>\n\nusing namespace rvarago::absent;\n")
+
+if(PIPELINES GREATER 0)
+    math(EXPR last_pipeline "${PIPELINES} - 1")
+    foreach(pipeline RANGE ${last_pipeline})
+        set(chain "input")
+        if(DEPTH GREATER 0)
+            foreach(stage RANGE 1 ${DEPTH})
+                math(EXPR kind "${stage} % 2")
+                if(kind EQUAL 1)
+                    set(chain "(${chain} | [](int x) { return x + ${stage}; })")
+                else()
+                    set(chain "(${chain} >> [](int x) { return x > ${stage} ? std::optional{x} : std::nullopt; })")
+                endif()
+            endforeach()
+        endif()
+        string(APPEND content "\nstd::optional<int> pipeline_${pipeline}(std::optional<int> const &input) {\n")
+        string(APPEND content "    return ${chain};\n}\n")
+    endforeach()
+endif()
+
+file(WRITE ${OUTPUT} "${content}")
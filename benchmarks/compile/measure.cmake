@@ -0,0 +1,90 @@
+# Compiles SOURCE into OBJECT with COMPILER and FLAGS, measures the wall-clock time, appends it as a JSON line to REPORT,
+# and fails if it exceeded BUDGET milliseconds.
+#
+# Besides, it reads the frontend, template instantiation, and backend totals from the report of the compiler, i.e. the
+# trace written by -ftime-trace next to OBJECT (Clang) or the report printed by -ftime-report (GCC).
+#
+# Usage: cmake -DNAME=<name> -DCOMPILER=<compiler> -DCOMPILER_ID=<Clang|GNU> -DFLAGS=<flags> -DSOURCE=<file>
+#              -DOBJECT=<file> -DBUDGET=<ms> -DREPORT=<file> -P measure.cmake
+
+cmake_minimum_required(VERSION 3.23)
+
+foreach(variable NAME COMPILER COMPILER_ID FLAGS SOURCE OBJECT BUDGET REPORT)
+    if(NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} must be defined")
+    endif()
+endforeach()
+
+function(now_in_microseconds result)
+    string(TIMESTAMP microseconds "%s%f" UTC)
+    set(${result} "${microseconds}" PARENT_SCOPE)
+endfunction()
+
+# Sets result to the wall-clock milliseconds of the timer variable label in the -ftime-report of GCC, or 0 if missing.
+function(gcc_wall_milliseconds time_report label result)
+    set(column "[0-9.]+ +\\( *[0-9]+%\\)")
+    if(time_report MATCHES "\n ${label} +: +${column} +${column} +([0-9]+)\\.([0-9]+)")
+        string(SUBSTRING "${CMAKE_MATCH_2}000" 0 3 fraction)
+        math(EXPR milliseconds "${CMAKE_MATCH_1} * 1000 + ${fraction}")
+        set(${result} ${milliseconds} PARENT_SCOPE)
+    else()
+        set(${result} 0 PARENT_SCOPE)
+    endif()
+endfunction()
+
+# Sets result to the milliseconds of the event "Total <label>" in the -ftime-trace of Clang, or 0 if missing.
+function(clang_total_milliseconds time_trace label result)
+    if(time_trace MATCHES "\"dur\": *([0-9]+), *\"name\": *\"Total ${label}\"")
+        math(EXPR milliseconds "${CMAKE_MATCH_1} / 1000")
+        set(${result} ${milliseconds} PARENT_SCOPE)
+    else()
+        set(${result} 0 PARENT_SCOPE)
+    endif()
+endfunction()
+
+separate_arguments(flags UNIX_COMMAND "${FLAGS}")
+
+now_in_microseconds(start)
+execute_process(
+        COMMAND ${COMPILER} ${flags} -c ${SOURCE} -o ${OBJECT}
+        RESULT_VARIABLE result
+        ERROR_FILE ${OBJECT}.stderr.txt
+)
+now_in_microseconds(stop)
+
+if(NOT result EQUAL 0)
+    file(READ ${OBJECT}.stderr.txt errors)
+    message(FATAL_ERROR "Failed to compile ${SOURCE}:\n${errors}")
+endif()
+
+math(EXPR elapsed "(${stop} - ${start}) / 1000")
+
+if(COMPILER_ID MATCHES "Clang")
+    get_filename_component(directory ${OBJECT} DIRECTORY)
+    get_filename_component(stem ${OBJECT} NAME_WLE)
+    file(READ ${directory}/${stem}.json time_trace)
+    clang_total_milliseconds("${time_trace}" "Frontend" frontend)
+    clang_total_milliseconds("${time_trace}" "InstantiateClass" instantiate_class)
+    clang_total_milliseconds("${time_trace}" "InstantiateFunction" instantiate_function)
+    math(EXPR instantiation "${instantiate_class} + ${instantiate_function}")
+    clang_total_milliseconds("${time_trace}" "Backend" backend)
+else()
+    file(READ ${OBJECT}.stderr.txt time_report)
+    gcc_wall_milliseconds("${time_report}" "phase parsing" parsing)
+    gcc_wall_milliseconds("${time_report}" "phase lang. deferred" deferred)
+    math(EXPR frontend "${parsing} + ${deferred}")
+    gcc_wall_milliseconds("${time_report}" "template instantiation" instantiation)
+    gcc_wall_milliseconds("${time_report}" "phase opt and generate" backend)
+endif()
+
+file(APPEND ${REPORT}
+     "{\"name\": \"${NAME}\", \"milliseconds\": ${elapsed}, \"budget_milliseconds\": ${BUDGET}, "
+     "\"frontend_milliseconds\": ${frontend}, \"template_instantiation_milliseconds\": ${instantiation}, "
+     "\"backend_milliseconds\": ${backend}}\n")
+
+set(breakdown "frontend ${frontend} ms, template instantiation ${instantiation} ms, backend ${backend} ms")
+if(elapsed GREATER BUDGET)
+    message(FATAL_ERROR "${NAME} took ${elapsed} ms to compile (${breakdown}), above its budget of ${BUDGET} ms")
+else()
+    message(STATUS "${NAME} took ${elapsed} ms to compile (${breakdown}), within its budget of ${BUDGET} ms")
+endif()
@@ -0,0 +1,72 @@
+#include <absent/adapters/either/transform.h>
+
+#include "payload.h"
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::either;
+using namespace rvarago::absent::benchmarks;
+using rvarago::absent::adapters::types::either;
+using rvarago::absent::adapters::types::in_place_error;
+
+namespace {
+
+// Long enough not to fit in the small string buffer, as a typical error message.
+constexpr auto message = "the request has an invalid field at position";
+
+template <typename String, typename Allocator>
+auto make_either(std::size_t i, int empty_rate, Allocator const &allocator) -> either<int, String> {
+    if (is_empty_at(i, empty_rate)) {
+        return either<int, String>{std::allocator_arg, allocator, in_place_error, message};
+    }
+    return either<int, String>{static_cast<int>(i)};
+}
+
+template <typename String>
+auto checksum(either<int, String> const &output) -> std::size_t {
+    return output.has_value() ? static_cast<std::size_t>(*output) : output.error().size();
+}
+
+// Maps each input through four stages, keeping every intermediate either alive, as when reporting them later.
+template <typename String>
+auto run_stages(either<int, String> const &input) -> std::size_t {
+    auto const increment = [](int x) { return x + 1; };
+    auto const first = transform(input, increment);
+    auto const second = transform(first, increment);
+    auto const third = transform(second, increment);
+    auto const fourth = transform(third, increment);
+    return checksum(fourth);
+}
+
+void benchmark_allocator(int empty_rate) {
+    BENCHMARK(name_of("either-transform-errors", "std::string", "int", 4, empty_rate)) {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < batch_size; ++i) {
+            sum += run_stages(make_either<std::string>(i, empty_rate, std::allocator<char>{}));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("either-transform-errors", "pmr::string-arena", "int", 4, empty_rate)) {
+        auto buffer = std::array<std::byte, 4096>{};
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < batch_size; ++i) {
+            // One arena per request, whose errors are freed at once.
+            auto arena = std::pmr::monotonic_buffer_resource{buffer.data(), buffer.size()};
+            auto const allocator = std::pmr::polymorphic_allocator<char>{&arena};
+            sum += run_stages(make_either<std::pmr::string>(i, empty_rate, allocator));
+        }
+        return sum;
+    };
+}
+
+}
+
+TEST_CASE("either<A, E> with errors allocated in an arena against the global heap", "[either][allocator]") {
+    benchmark_allocator(GENERATE(from_range(empty_rates)));
+}
@@ -0,0 +1,59 @@
+#include <absent/adapters/either/attempt.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <stdexcept>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::either;
+using namespace rvarago::absent::benchmarks;
+using rvarago::absent::adapters::types::either;
+
+namespace {
+
+template <typename Payload>
+auto make_or_throw(std::size_t i, int empty_rate) -> Payload {
+    if (is_empty_at(i, empty_rate)) {
+        throw std::runtime_error{"empty"};
+    }
+    return payload_traits<Payload>::make(i);
+}
+
+template <typename Payload>
+auto checksum(either<Payload, std::runtime_error> const &output) -> std::size_t {
+    return output.has_value() ? payload_traits<Payload>::checksum(*output) : 0;
+}
+
+template <typename Payload>
+void benchmark_attempt(int empty_rate) {
+    auto const payload = payload_traits<Payload>::name;
+
+    BENCHMARK(name_of("either-attempt", "absent", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < batch_size; ++i) {
+            sum += checksum(
+                attempt<std::runtime_error>([i, empty_rate] { return make_or_throw<Payload>(i, empty_rate); }));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("either-attempt", "hand-written", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < batch_size; ++i) {
+            try {
+                sum += checksum(either<Payload, std::runtime_error>{make_or_throw<Payload>(i, empty_rate)});
+            } catch (std::runtime_error const &ex) {
+                sum += checksum(either<Payload, std::runtime_error>{ex});
+            }
+        }
+        return sum;
+    };
+}
+
+}
+
+TEMPLATE_TEST_CASE("attempt against hand-written code for either<A, E>", "[either-attempt]", int, pod64, heap) {
+    benchmark_attempt<TestType>(GENERATE(from_range(empty_rates)));
+}
@@ -0,0 +1,78 @@
+#include <absent/adapters/either/and_then.h>
+#include <absent/adapters/either/context.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::either;
+using namespace rvarago::absent::benchmarks;
+using rvarago::absent::adapters::types::contextual_error;
+using rvarago::absent::adapters::types::either;
+using namespace rvarago::absent::adapters::types::literals;
+
+namespace {
+
+enum class code { not_found };
+
+using lazy_error = contextual_error<code>;
+
+// Most errors are only counted, hence their messages are never read.
+template <typename E>
+auto count(either<int, E> const &output) -> std::size_t {
+    return output.has_value() ? static_cast<std::size_t>(*output) : 1;
+}
+
+void benchmark_context(int empty_rate) {
+    BENCHMARK(name_of("either-context", "eager-string", "int", 3, empty_rate)) {
+        auto const load = [empty_rate](int id) -> either<int, std::string> {
+            if (is_empty_at(static_cast<std::size_t>(id), empty_rate)) {
+                return "user " + std::to_string(id) + " not found";
+            }
+            return id;
+        };
+        auto const in_shard = [](either<int, std::string> input, int id, int shard) {
+            if (!input.has_value()) {
+                input.error() += ", while loading user " + std::to_string(id) + " from shard " + std::to_string(shard);
+            }
+            return input;
+        };
+        auto const in_request = [](either<int, std::string> input, int id) {
+            if (!input.has_value()) {
+                input.error() += ", while handling request " + std::to_string(id);
+            }
+            return input;
+        };
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < batch_size; ++i) {
+            auto const id = static_cast<int>(i);
+            sum += count(in_request(in_shard(load(id), id, 7), id));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("either-context", "absent", "int", 3, empty_rate)) {
+        auto const load = [empty_rate](int id) -> either<int, lazy_error> {
+            if (is_empty_at(static_cast<std::size_t>(id), empty_rate)) {
+                return lazy_error{code::not_found, "user {} not found"_lit, id};
+            }
+            return id;
+        };
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < batch_size; ++i) {
+            auto const id = static_cast<int>(i);
+            sum += count(with_context(with_context(load(id), "while loading user {} from shard {}"_lit, id, 7),
+                                      "while handling request {}"_lit, id));
+        }
+        return sum;
+    };
+}
+
+}
+
+TEST_CASE("contextual_error against eagerly formatted std::string errors", "[either][context]") {
+    benchmark_context(GENERATE(from_range(empty_rates)));
+}
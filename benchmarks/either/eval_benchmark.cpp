@@ -0,0 +1,41 @@
+#include <absent/adapters/either/eval.h>
+
+#include "payload.h"
+
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::either;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+template <typename Payload>
+void benchmark_eval(int empty_rate) {
+    auto const inputs = make_eithers<Payload>(empty_rate);
+    auto const fallback = [] { return payload_traits<Payload>::make(0); };
+    auto const payload = payload_traits<Payload>::name;
+
+    BENCHMARK(name_of("either-eval", "absent", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += payload_traits<Payload>::checksum(eval(input, fallback));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("either-eval", "hand-written", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += payload_traits<Payload>::checksum(input.has_value() ? *input : fallback());
+        }
+        return sum;
+    };
+}
+
+}
+
+TEMPLATE_TEST_CASE("eval against hand-written code for either<A, E>", "[either-eval]", int, pod64, heap) {
+    benchmark_eval<TestType>(GENERATE(from_range(empty_rates)));
+}
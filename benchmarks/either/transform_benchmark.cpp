@@ -0,0 +1,92 @@
+#include <absent/adapters/either/fuse.h>
+#include <absent/adapters/either/transform.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::either;
+using namespace rvarago::absent::benchmarks;
+using rvarago::absent::adapters::types::either;
+
+namespace {
+
+template <std::size_t Depth, typename Either, typename UnaryFunction>
+auto transform_chain(Either &&input, UnaryFunction const &step) {
+    if constexpr (Depth == 1) {
+        return std::forward<Either>(input) | step;
+    } else {
+        return transform_chain<Depth - 1>(std::forward<Either>(input) | step, step);
+    }
+}
+
+template <std::size_t Depth, typename Pipeline, typename UnaryFunction>
+constexpr auto transform_pipeline(Pipeline pipeline, UnaryFunction const &step) {
+    if constexpr (Depth == 0) {
+        return pipeline;
+    } else {
+        return transform_pipeline<Depth - 1>(std::move(pipeline) | step, step);
+    }
+}
+
+template <std::size_t Depth, typename Payload, typename UnaryFunction>
+auto hand_written_transform(either<Payload, error> const &input, UnaryFunction const &step)
+    -> either<Payload, error> {
+    if (!input.has_value()) {
+        return either<Payload, error>{input.error()};
+    }
+    auto value = step(*input);
+    for (std::size_t i = 1; i < Depth; ++i) {
+        value = step(std::move(value));
+    }
+    return either<Payload, error>{std::move(value)};
+}
+
+template <typename Payload>
+auto checksum(either<Payload, error> const &output) -> std::size_t {
+    return output.has_value() ? payload_traits<Payload>::checksum(*output) : 0;
+}
+
+template <std::size_t Depth, typename Payload>
+void benchmark_transform(int empty_rate) {
+    auto const inputs = make_eithers<Payload>(empty_rate);
+    auto const step = [](Payload value) { return payload_traits<Payload>::step(std::move(value)); };
+    auto const pipeline = transform_pipeline<Depth>(fuse(), step);
+    auto const payload = payload_traits<Payload>::name;
+
+    BENCHMARK(name_of("either-transform", "absent", payload, Depth, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += checksum(transform_chain<Depth>(input, step));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("either-transform", "absent-fused", payload, Depth, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += checksum(input | pipeline);
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("either-transform", "hand-written", payload, Depth, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += checksum(hand_written_transform<Depth>(input, step));
+        }
+        return sum;
+    };
+}
+
+}
+
+TEMPLATE_TEST_CASE("transform against hand-written code for either<A, E>", "[either-transform]", int, pod64, heap) {
+    auto const empty_rate = GENERATE(from_range(empty_rates));
+    benchmark_transform<1, TestType>(empty_rate);
+    benchmark_transform<4, TestType>(empty_rate);
+    benchmark_transform<8, TestType>(empty_rate);
+}
@@ -0,0 +1,42 @@
+#include <absent/eval.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <optional>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+template <typename Payload>
+void benchmark_eval(int empty_rate) {
+    auto const inputs = make_optionals<Payload>(empty_rate);
+    auto const fallback = [] { return payload_traits<Payload>::make(0); };
+    auto const payload = payload_traits<Payload>::name;
+
+    BENCHMARK(name_of("eval", "absent", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += payload_traits<Payload>::checksum(eval(input, fallback));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("eval", "hand-written", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += payload_traits<Payload>::checksum(input ? *input : fallback());
+        }
+        return sum;
+    };
+}
+
+}
+
+TEMPLATE_TEST_CASE("eval against hand-written code for optional<A>", "[eval]", int, pod64, heap) {
+    benchmark_eval<TestType>(GENERATE(from_range(empty_rates)));
+}
@@ -0,0 +1,63 @@
+#include <absent/first_of.h>
+#include <absent/support/work_stealing_pool.h>
+
+#include "payload.h"
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+// Lookups are slow, hence the batch is kept small for the benchmark to finish in a reasonable time.
+constexpr std::size_t lookups = 16;
+
+constexpr auto fast = std::chrono::microseconds{50};
+constexpr auto slow = std::chrono::milliseconds{2};
+
+// The primary backend is slow for the lookups selected by slow_rate, i.e. its tail latency, whereas the replica is
+// always fast. The slow rate is reported in place of the empty rate.
+void benchmark_first_of(int slow_rate) {
+    support::work_stealing_pool pool{4};
+
+    auto const primary_of = [slow_rate](std::size_t i) {
+        return [slow_rate, i] {
+            std::this_thread::sleep_for(is_empty_at(i, slow_rate) ? std::chrono::microseconds{slow} : fast);
+            return std::optional{static_cast<int>(i)};
+        };
+    };
+    auto const replica_of = [](std::size_t i) {
+        return [i] {
+            std::this_thread::sleep_for(fast);
+            return std::optional{static_cast<int>(i)};
+        };
+    };
+
+    BENCHMARK(name_of("first_of", "sequential", "int", 2, slow_rate)) {
+        int sum = 0;
+        for (std::size_t i = 0; i < lookups; ++i) {
+            sum += *first_of(primary_of(i), replica_of(i));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("first_of", "hedged-200us", "int", 2, slow_rate)) {
+        int sum = 0;
+        for (std::size_t i = 0; i < lookups; ++i) {
+            sum += *first_of(pool, std::chrono::microseconds{200}, primary_of(i), replica_of(i)).get();
+        }
+        return sum;
+    };
+}
+
+}
+
+TEST_CASE("Hedged first_of against trying the alternatives sequentially", "[first_of]") {
+    benchmark_first_of(GENERATE(from_range(empty_rates)));
+}
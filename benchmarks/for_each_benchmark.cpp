@@ -0,0 +1,44 @@
+#include <absent/for_each.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <optional>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+template <typename Payload>
+void benchmark_for_each(int empty_rate) {
+    auto const inputs = make_optionals<Payload>(empty_rate);
+    auto const payload = payload_traits<Payload>::name;
+
+    BENCHMARK(name_of("for_each", "absent", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        auto const accumulate = [&sum](Payload const &value) { sum += payload_traits<Payload>::checksum(value); };
+        for (auto const &input : inputs) {
+            for_each(input, accumulate);
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("for_each", "hand-written", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            if (input) {
+                sum += payload_traits<Payload>::checksum(*input);
+            }
+        }
+        return sum;
+    };
+}
+
+}
+
+TEMPLATE_TEST_CASE("for_each against hand-written code for optional<A>", "[for_each]", int, pod64, heap) {
+    benchmark_for_each<TestType>(GENERATE(from_range(empty_rates)));
+}
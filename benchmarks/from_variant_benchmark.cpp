@@ -0,0 +1,129 @@
+#include <absent/support/from_variant.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+template <typename Payload>
+auto checksum(std::optional<Payload> const &output) -> std::size_t {
+    return output ? payload_traits<Payload>::checksum(*output) : 0;
+}
+
+template <typename Payload>
+void benchmark_from_variant(int empty_rate) {
+    auto inputs = std::vector<std::variant<Payload, error>>{};
+    inputs.reserve(batch_size);
+    for (std::size_t i = 0; i < batch_size; ++i) {
+        if (is_empty_at(i, empty_rate)) {
+            inputs.emplace_back(error{static_cast<int>(i)});
+        } else {
+            inputs.emplace_back(payload_traits<Payload>::make(i));
+        }
+    }
+    auto const payload = payload_traits<Payload>::name;
+
+    BENCHMARK(name_of("from_variant", "absent", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += checksum(from_variant<Payload>(input));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("from_variant_ref", "absent", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            auto const value = from_variant_ref<Payload>(input);
+            sum += value ? payload_traits<Payload>::checksum(*value) : 0;
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("from_variant", "hand-written", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            auto const p = std::get_if<Payload>(&input);
+            sum += checksum(p ? std::optional<Payload>{*p} : std::nullopt);
+        }
+        return sum;
+    };
+}
+
+}
+
+TEMPLATE_TEST_CASE("from_variant against hand-written code for variant<A, E>", "[from_variant]", int, pod64, heap) {
+    benchmark_from_variant<TestType>(GENERATE(from_range(empty_rates)));
+}
+
+namespace {
+
+template <std::size_t Tag>
+struct message final {
+    int sequence;
+};
+
+using messages = std::variant<message<0>, message<1>, message<2>, message<3>, message<4>, message<5>, message<6>,
+                              message<7>, heap>;
+
+template <std::size_t... Tags>
+auto make_message(std::size_t tag, int sequence, std::index_sequence<Tags...>) -> messages {
+    auto result = messages{};
+    ((tag == Tags ? (result = message<Tags>{sequence}, true) : false) || ...);
+    return result;
+}
+
+auto checksum_of(std::variant<message<5>, message<6>, message<7>> const &selected) -> std::size_t {
+    return std::visit([](auto const &m) { return static_cast<std::size_t>(m.sequence); }, selected);
+}
+
+}
+
+TEST_CASE("project_variant against sequential from_variant for a variant of nine alternatives", "[from_variant]") {
+    auto inputs = std::vector<messages>{};
+    inputs.reserve(batch_size);
+    for (std::size_t i = 0; i < batch_size; ++i) {
+        auto const sequence = static_cast<int>(i);
+        // Each of the nine alternatives is equally frequent, where the last one is large and never requested.
+        if (i % 9 == 8) {
+            inputs.emplace_back(payload_traits<heap>::make(i));
+        } else {
+            inputs.push_back(make_message(i % 9, sequence, std::make_index_sequence<8>{}));
+        }
+    }
+
+    BENCHMARK(name_of("project_variant", "absent", "message", 3, 0)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            if (auto const selected = project_variant<message<5>, message<6>, message<7>>(input); selected) {
+                sum += checksum_of(*selected);
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("project_variant", "sequential-from_variant", "message", 3, 0)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            if (auto const m5 = from_variant<message<5>>(input); m5) {
+                sum += static_cast<std::size_t>(m5->sequence);
+            } else if (auto const m6 = from_variant<message<6>>(input); m6) {
+                sum += static_cast<std::size_t>(m6->sequence);
+            } else if (auto const m7 = from_variant<message<7>>(input); m7) {
+                sum += static_cast<std::size_t>(m7->sequence);
+            }
+        }
+        return sum;
+    };
+}
+
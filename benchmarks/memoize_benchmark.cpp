@@ -0,0 +1,68 @@
+#include <absent/and_then.h>
+#include <absent/memoize.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+// The batch looks up the same few keys again and again, as a stage like find_address(person) does.
+constexpr std::size_t distinct_keys = 64;
+
+// Stands for an expensive lookup, e.g. a query, which fails for the keys selected by empty_rate.
+auto lookup(std::size_t key, int empty_rate) -> std::optional<std::uint64_t> {
+    auto hash = std::uint64_t{key} + 1;
+    for (int i = 0; i < 2000; ++i) {
+        hash = hash * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    if (is_empty_at(key, empty_rate)) {
+        return std::nullopt;
+    }
+    return hash;
+}
+
+template <typename UnaryFunction>
+auto run_batch(UnaryFunction const &find) -> std::uint64_t {
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < batch_size; ++i) {
+        sum += (std::optional{i % distinct_keys} >> find).value_or(1);
+    }
+    return sum;
+}
+
+void benchmark_memoize(int empty_rate) {
+    auto const find = [empty_rate](std::size_t key) { return lookup(key, empty_rate); };
+
+    BENCHMARK(name_of("memoize", "uncached", "uint64", 1, empty_rate)) {
+        return run_batch(find);
+    };
+
+    BENCHMARK(name_of("memoize", "absent-lru", "uint64", 1, empty_rate)) {
+        return run_batch(memoize<std::size_t>(find));
+    };
+
+    auto options = memoize_options{};
+    options.policy = eviction::clock;
+    BENCHMARK(name_of("memoize", "absent-clock", "uint64", 1, empty_rate)) {
+        return run_batch(memoize<std::size_t>(find, options));
+    };
+
+    options.cache_failures = false;
+    BENCHMARK(name_of("memoize", "absent-clock-no-negative-caching", "uint64", 1, empty_rate)) {
+        return run_batch(memoize<std::size_t>(find, options));
+    };
+}
+
+}
+
+TEST_CASE("memoize against calling the function every time", "[memoize]") {
+    benchmark_memoize(GENERATE(from_range(empty_rates)));
+}
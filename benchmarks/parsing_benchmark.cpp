@@ -0,0 +1,57 @@
+#include <absent/attempt.h>
+#include <absent/parsing.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+auto make_texts(int empty_rate) -> std::vector<std::string> {
+    auto texts = std::vector<std::string>{};
+    texts.reserve(batch_size);
+    for (std::size_t i = 0; i < batch_size; ++i) {
+        texts.push_back(is_empty_at(i, empty_rate) ? "n/a" : std::to_string(i));
+    }
+    return texts;
+}
+
+auto checksum(std::optional<int> const &output) -> std::size_t {
+    return output ? static_cast<std::size_t>(*output) : 0;
+}
+
+void benchmark_parsing(int empty_rate) {
+    auto const texts = make_texts(empty_rate);
+
+    BENCHMARK(name_of("parsing", "attempt-stoi", "int", 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &text : texts) {
+            sum += checksum(attempt([&text] { return std::stoi(text); }));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("parsing", "absent", "int", 1, empty_rate)) {
+        auto const to_int = parsing::integer<int>();
+        std::size_t sum = 0;
+        for (auto const &text : texts) {
+            sum += checksum(to_int(text));
+        }
+        return sum;
+    };
+}
+
+}
+
+TEST_CASE("parsing::integer against attempt(std::stoi)", "[parsing]") {
+    benchmark_parsing(GENERATE(from_range(empty_rates)));
+}
@@ -0,0 +1,152 @@
+#ifndef RVARAGO_ABSENT_BENCHMARKS_PAYLOAD_H
+#define RVARAGO_ABSENT_BENCHMARKS_PAYLOAD_H
+
+#include <absent/adapters/either/either.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace rvarago::absent::benchmarks {
+
+/**
+ * Number of nullables processed by each benchmark run.
+ */
+inline constexpr std::size_t batch_size = 1024;
+
+/**
+ * Percentages of empty (or in error) nullables in each batch.
+ */
+inline constexpr std::array<int, 3> empty_rates = {0, 50, 99};
+
+/**
+ * A trivially copyable payload that spans a full cache line.
+ */
+struct pod64 final {
+    std::array<std::uint8_t, 64> bytes;
+};
+
+/**
+ * A payload that owns heap memory and is therefore expensive to copy, but cheap to move.
+ */
+struct heap final {
+    std::string text;
+    std::vector<int> numbers;
+};
+
+struct error final {
+    int code;
+};
+
+template <typename Payload>
+struct payload_traits;
+
+template <>
+struct payload_traits<int> final {
+    static constexpr char const *name = "int";
+
+    static auto make(std::size_t i) -> int {
+        return static_cast<int>(i);
+    }
+
+    static auto step(int value) -> int {
+        return value + 1;
+    }
+
+    static auto checksum(int const &value) -> std::size_t {
+        return static_cast<std::size_t>(value);
+    }
+};
+
+template <>
+struct payload_traits<pod64> final {
+    static constexpr char const *name = "pod64";
+
+    static auto make(std::size_t i) -> pod64 {
+        auto value = pod64{};
+        value.bytes.fill(static_cast<std::uint8_t>(i));
+        return value;
+    }
+
+    static auto step(pod64 value) -> pod64 {
+        ++value.bytes.front();
+        ++value.bytes.back();
+        return value;
+    }
+
+    static auto checksum(pod64 const &value) -> std::size_t {
+        return value.bytes.front() + value.bytes.back();
+    }
+};
+
+template <>
+struct payload_traits<heap> final {
+    static constexpr char const *name = "heap";
+
+    static auto make(std::size_t i) -> heap {
+        return heap{std::string(256, static_cast<char>('a' + i % 26)), std::vector<int>(64, static_cast<int>(i))};
+    }
+
+    static auto step(heap value) -> heap {
+        ++value.text.front();
+        ++value.numbers.front();
+        return value;
+    }
+
+    static auto checksum(heap const &value) -> std::size_t {
+        return value.text.size() + static_cast<std::size_t>(value.numbers.front());
+    }
+};
+
+/**
+ * Whether the i-th element of a batch should be empty, so that roughly empty_rate% of the elements are.
+ */
+inline auto is_empty_at(std::size_t i, int empty_rate) -> bool {
+    constexpr std::size_t stride = 37;
+    return static_cast<int>(i * stride % 100) < empty_rate;
+}
+
+template <typename Payload>
+auto make_optionals(int empty_rate) -> std::vector<std::optional<Payload>> {
+    auto batch = std::vector<std::optional<Payload>>{};
+    batch.reserve(batch_size);
+    for (std::size_t i = 0; i < batch_size; ++i) {
+        if (is_empty_at(i, empty_rate)) {
+            batch.emplace_back(std::nullopt);
+        } else {
+            batch.emplace_back(payload_traits<Payload>::make(i));
+        }
+    }
+    return batch;
+}
+
+template <typename Payload>
+auto make_eithers(int empty_rate) -> std::vector<adapters::types::either<Payload, error>> {
+    auto batch = std::vector<adapters::types::either<Payload, error>>{};
+    batch.reserve(batch_size);
+    for (std::size_t i = 0; i < batch_size; ++i) {
+        if (is_empty_at(i, empty_rate)) {
+            batch.emplace_back(error{static_cast<int>(i)});
+        } else {
+            batch.emplace_back(payload_traits<Payload>::make(i));
+        }
+    }
+    return batch;
+}
+
+/**
+ * Builds the name of a benchmark as combinator/implementation/payload/depth/empty_rate, e.g.
+ * "transform/absent/int/depth=4/empty=50%".
+ */
+inline auto name_of(std::string const &combinator, std::string const &implementation, char const *payload,
+                    std::size_t depth, int empty_rate) -> std::string {
+    return combinator + "/" + implementation + "/" + payload + "/depth=" + std::to_string(depth) +
+           "/empty=" + std::to_string(empty_rate) + "%";
+}
+
+}
+
+#endif
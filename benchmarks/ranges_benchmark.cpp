@@ -0,0 +1,45 @@
+#include <absent/ranges.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <optional>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+template <typename Payload>
+void benchmark_ranges(int empty_rate) {
+    auto const payload = payload_traits<Payload>::name;
+    auto const input = make_optionals<Payload>(empty_rate);
+    auto const step = [](Payload const &value) { return payload_traits<Payload>::step(value); };
+
+    BENCHMARK(name_of("transform_present", "absent", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &value : input | views::transform_present(step)) {
+            sum += payload_traits<Payload>::checksum(value);
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("transform_present", "hand-written", payload, 1, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &nullable : input) {
+            if (nullable) {
+                sum += payload_traits<Payload>::checksum(step(*nullable));
+            }
+        }
+        return sum;
+    };
+}
+
+}
+
+TEMPLATE_TEST_CASE("transform_present against hand-written code for ranges of optional<A>", "[ranges]", int, pod64,
+                   heap) {
+    benchmark_ranges<TestType>(GENERATE(from_range(empty_rates)));
+}
@@ -0,0 +1,91 @@
+#include <absent/fuse.h>
+#include <absent/transform.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+template <std::size_t Depth, typename Nullable, typename UnaryFunction>
+auto transform_chain(Nullable &&input, UnaryFunction const &step) {
+    if constexpr (Depth == 1) {
+        return std::forward<Nullable>(input) | step;
+    } else {
+        return transform_chain<Depth - 1>(std::forward<Nullable>(input) | step, step);
+    }
+}
+
+template <std::size_t Depth, typename Pipeline, typename UnaryFunction>
+constexpr auto transform_pipeline(Pipeline pipeline, UnaryFunction const &step) {
+    if constexpr (Depth == 0) {
+        return pipeline;
+    } else {
+        return transform_pipeline<Depth - 1>(std::move(pipeline) | step, step);
+    }
+}
+
+template <std::size_t Depth, typename Payload, typename UnaryFunction>
+auto hand_written_transform(std::optional<Payload> const &input, UnaryFunction const &step) -> std::optional<Payload> {
+    if (!input) {
+        return std::nullopt;
+    }
+    auto value = step(*input);
+    for (std::size_t i = 1; i < Depth; ++i) {
+        value = step(std::move(value));
+    }
+    return std::optional<Payload>{std::move(value)};
+}
+
+template <typename Payload>
+auto checksum(std::optional<Payload> const &output) -> std::size_t {
+    return output ? payload_traits<Payload>::checksum(*output) : 0;
+}
+
+template <std::size_t Depth, typename Payload>
+void benchmark_transform(int empty_rate) {
+    auto const inputs = make_optionals<Payload>(empty_rate);
+    auto const step = [](Payload value) { return payload_traits<Payload>::step(std::move(value)); };
+    auto const pipeline = transform_pipeline<Depth>(fuse(), step);
+    auto const payload = payload_traits<Payload>::name;
+
+    BENCHMARK(name_of("transform", "absent", payload, Depth, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += checksum(transform_chain<Depth>(input, step));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("transform", "absent-fused", payload, Depth, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += checksum(input | pipeline);
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("transform", "hand-written", payload, Depth, empty_rate)) {
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += checksum(hand_written_transform<Depth>(input, step));
+        }
+        return sum;
+    };
+}
+
+}
+
+TEMPLATE_TEST_CASE("transform against hand-written code for optional<A>", "[transform]", int, pod64, heap) {
+    auto const empty_rate = GENERATE(from_range(empty_rates));
+    benchmark_transform<1, TestType>(empty_rate);
+    benchmark_transform<4, TestType>(empty_rate);
+    benchmark_transform<8, TestType>(empty_rate);
+}
@@ -0,0 +1,79 @@
+#include <absent/adapters/validated/lift.h>
+
+#include "payload.h"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+using checked_int = types::validated<int, error>;
+
+auto make_fields(int empty_rate) -> std::vector<int> {
+    auto fields = std::vector<int>{};
+    fields.reserve(batch_size);
+    for (std::size_t i = 0; i < batch_size; ++i) {
+        fields.push_back(is_empty_at(i, empty_rate) ? -static_cast<int>(i) - 1 : static_cast<int>(i));
+    }
+    return fields;
+}
+
+auto check(int field, int code) -> checked_int {
+    return field < 0 ? checked_int{types::in_place_error, error{code}} : checked_int{field};
+}
+
+// The baseline runs every check and pushes the errors into a std::vector, which it returns alongside the result.
+struct accumulated final {
+    std::optional<int> value;
+    std::vector<error> errors;
+};
+
+auto check_into(int field, int code, std::vector<error> &errors) -> std::optional<int> {
+    if (field < 0) {
+        errors.push_back(error{code});
+        return std::nullopt;
+    }
+    return field;
+}
+
+void benchmark_validated(int empty_rate) {
+    auto const fields = make_fields(empty_rate);
+    auto const sum = [](int x, int y, int z) { return x + y + z; };
+
+    BENCHMARK(name_of("validated", "absent", "int", 3, empty_rate)) {
+        auto const sum_of = validated::lift(sum);
+        std::size_t checksum = 0;
+        for (auto const field : fields) {
+            auto const result = sum_of(check(field, 1), check(field, 2), check(field, 3));
+            checksum += result.has_value() ? static_cast<std::size_t>(*result) : result.errors().size();
+        }
+        return checksum;
+    };
+
+    BENCHMARK(name_of("validated", "vector", "int", 3, empty_rate)) {
+        std::size_t checksum = 0;
+        for (auto const field : fields) {
+            auto result = accumulated{};
+            auto const x = check_into(field, 1, result.errors);
+            auto const y = check_into(field, 2, result.errors);
+            auto const z = check_into(field, 3, result.errors);
+            if (result.errors.empty()) {
+                result.value = sum(*x, *y, *z);
+            }
+            checksum += result.value ? static_cast<std::size_t>(*result.value) : result.errors.size();
+        }
+        return checksum;
+    };
+}
+
+}
+
+TEST_CASE("validated::lift against accumulating errors into a std::vector", "[validated]") {
+    benchmark_validated(GENERATE(from_range(empty_rates)));
+}
@@ -0,0 +1,69 @@
+#include <absent/and_then.h>
+#include <absent/within.h>
+
+#include "payload.h"
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::benchmarks;
+
+namespace {
+
+constexpr std::size_t depth = 8;
+
+template <std::size_t Depth, typename Nullable, typename UnaryFunction>
+auto and_then_chain(Nullable const &input, UnaryFunction const &step) {
+    if constexpr (Depth == 1) {
+        return input >> step;
+    } else {
+        return and_then_chain<Depth - 1>(input >> step, step);
+    }
+}
+
+template <typename Deadline>
+auto run_within(std::vector<std::optional<int>> const &inputs, Deadline const &deadline) -> std::size_t {
+    auto const step = within(deadline, [](int value) { return std::optional{value + 1}; });
+    std::size_t sum = 0;
+    for (auto const &input : inputs) {
+        sum += static_cast<std::size_t>(and_then_chain<depth>(input, step).value_or(0));
+    }
+    return sum;
+}
+
+// The budget never expires, hence it measures what checking the deadline costs a pipeline of cheap stages.
+void benchmark_within(int empty_rate) {
+    auto const inputs = make_optionals<int>(empty_rate);
+    auto const budget = std::chrono::hours{1};
+
+    BENCHMARK(name_of("within", "no-deadline", "int", depth, empty_rate)) {
+        auto const step = [](int value) { return std::optional{value + 1}; };
+        std::size_t sum = 0;
+        for (auto const &input : inputs) {
+            sum += static_cast<std::size_t>(and_then_chain<depth>(input, step).value_or(0));
+        }
+        return sum;
+    };
+
+    BENCHMARK(name_of("within", "steady-every-check", "int", depth, empty_rate)) {
+        return run_within(inputs, support::deadline::after(budget));
+    };
+
+    BENCHMARK(name_of("within", "steady-every-8-checks", "int", depth, empty_rate)) {
+        return run_within(inputs, support::deadline::after(budget, 8));
+    };
+
+    BENCHMARK(name_of("within", "coarse-every-check", "int", depth, empty_rate)) {
+        return run_within(inputs, support::coarse_deadline::after(budget));
+    };
+}
+
+}
+
+TEST_CASE("within against a pipeline without a deadline", "[within]") {
+    benchmark_within(GENERATE(from_range(empty_rates)));
+}
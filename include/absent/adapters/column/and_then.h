@@ -0,0 +1,52 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_COLUMN_ANDTHEN_H
+#define RVARAGO_ABSENT_ADAPTERS_COLUMN_ANDTHEN_H
+
+#include "absent/adapters/column/nullable_column.h"
+#include "absent/support/invoke.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::adapters::column {
+
+/***
+ * Given a nullable_column<A>, and an unary function f: A -> N<B> where N<B> is a nullable type (i.e. optional-like
+ * object):
+ * - For every empty slot: it should leave the corresponding slot of the new nullable_column<B> empty, without calling
+ * f.
+ * - For every *not* empty slot: it should fill the corresponding slot of the new nullable_column<B> with the value
+ * wrapped by the nullable returned by f, or leave it empty if such nullable is also empty.
+ *
+ * @param input a nullable_column<A>.
+ * @param mapper an unary function A -> N<B>.
+ * @return a new nullable_column generated by mapper, with at least the same empty slots as input.
+ */
+template <typename A, typename UnaryFunction>
+auto and_then(types::nullable_column<A> const &input, UnaryFunction &&mapper) -> types::nullable_column<
+    std::decay_t<decltype(*absent::detail::invoke(std::declval<UnaryFunction>(), std::declval<A>()))>> {
+    using B = std::decay_t<decltype(*absent::detail::invoke(mapper, std::declval<A>()))>;
+    auto output = types::nullable_column<B>(input.size());
+    auto const in = input.data();
+    detail::for_each_valid_run(input.validity(), [&](std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            if (auto next = absent::detail::invoke(mapper, in[i]); next) {
+                output.set(i, *std::move(next));
+            }
+        }
+    });
+    return output;
+}
+
+/***
+ * Infix version of and_then.
+ */
+template <typename A, typename UnaryFunction>
+auto operator>>(types::nullable_column<A> const &input, UnaryFunction &&mapper) -> types::nullable_column<
+    std::decay_t<decltype(*absent::detail::invoke(std::declval<UnaryFunction>(), std::declval<A>()))>> {
+    return and_then(input, std::forward<UnaryFunction>(mapper));
+}
+
+}
+
+#endif
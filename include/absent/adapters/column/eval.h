@@ -0,0 +1,34 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_COLUMN_EVAL_H
+#define RVARAGO_ABSENT_ADAPTERS_COLUMN_EVAL_H
+
+#include "absent/adapters/column/nullable_column.h"
+#include "absent/support/invoke.h"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace rvarago::absent::adapters::column {
+
+/***
+ * Given a nullable_column<A>, and a nullary function f: () -> A:
+ * - For every empty slot: it should evaluate the function f that returns a fallback instance of type A.
+ * - For every *not* empty slot: it should take the slot's value of type A.
+ *
+ * The values are copied as a whole, and f is evaluated only for the empty slots.
+ *
+ * @param input a nullable_column<A>.
+ * @param fallback a nullary function () -> A.
+ * @return the dense array of values, where each empty slot was replaced by the result of fallback.
+ */
+template <typename A, typename NullaryFunction>
+auto eval(types::nullable_column<A> const &input, NullaryFunction &&fallback) -> std::vector<A> {
+    auto output = input.values();
+    detail::for_each_empty(input.validity(), input.size(),
+                           [&](std::size_t i) { output[i] = absent::detail::invoke(fallback); });
+    return output;
+}
+
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_COLUMN_FOREACH_H
+#define RVARAGO_ABSENT_ADAPTERS_COLUMN_FOREACH_H
+
+#include "absent/adapters/column/nullable_column.h"
+#include "absent/support/invoke.h"
+
+#include <cstddef>
+#include <utility>
+
+namespace rvarago::absent::adapters::column {
+
+/***
+ * Given a nullable_column<A>, and an unary function f: A -> void:
+ * - For every empty slot: it should do nothing.
+ * - For every *not* empty slot: it should apply the unary function to the slot's value only for its side-effect.
+ *
+ * @param input a nullable_column<A>.
+ * @param action an unary function A -> void.
+ */
+template <typename A, typename UnaryFunction>
+auto for_each(types::nullable_column<A> const &input, UnaryFunction &&action) -> void {
+    auto const in = input.data();
+    detail::for_each_valid_run(input.validity(), [&](std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            absent::detail::invoke(action, in[i]);
+        }
+    });
+}
+
+}
+
+#endif
@@ -0,0 +1,271 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_COLUMN_NULLABLECOLUMN_H
+#define RVARAGO_ABSENT_ADAPTERS_COLUMN_NULLABLECOLUMN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rvarago::absent::adapters::types {
+
+/***
+ * A column of nullable values stored in a columnar layout, i.e. instead of a sequence of optional<A>, where the flag is
+ * interleaved with the values, it holds:
+ * - A dense array with the values, where empty slots hold a value-initialized A.
+ * - A packed validity bitmap, where the i-th bit is set when the i-th slot is not empty.
+ *
+ * Such that the values can be processed by tight, vectorizable, loops.
+ */
+template <typename A>
+class nullable_column final {
+    static_assert(std::is_default_constructible_v<A>, "Type A must be default constructible to fill empty slots");
+    static_assert(!std::is_same_v<A, bool>, "Type A must not be bool, since std::vector<bool> is not contiguous");
+
+  public:
+    using value_type = A;
+    using word_type = std::uint64_t;
+
+    static constexpr std::size_t word_size = 64;
+
+    nullable_column() = default;
+
+    /***
+     * Creates a column with size empty slots.
+     */
+    explicit nullable_column(std::size_t size) : _values(size), _validity(words_for(size)), _size{size} {
+    }
+
+    /***
+     * Creates a column with size slots, filled with value-initialized values where the validity bitmap has their bits
+     * set, and empty elsewhere. The bits past size are ignored.
+     */
+    nullable_column(std::size_t size, std::vector<word_type> validity)
+        : _values(size), _validity(std::move(validity)), _size{size} {
+        _validity.resize(words_for(size));
+        if (auto const tail = size % word_size; tail != 0) {
+            _validity.back() &= (word_type{1} << tail) - 1;
+        }
+    }
+
+    /***
+     * Creates a column from the range [first, last) of optional-like objects.
+     */
+    template <typename InputIterator>
+    nullable_column(InputIterator first, InputIterator last) {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+
+    auto size() const noexcept -> std::size_t {
+        return _size;
+    }
+
+    auto empty() const noexcept -> bool {
+        return _size == 0;
+    }
+
+    /***
+     * @return whether the i-th slot holds a value.
+     */
+    auto has_value(std::size_t i) const noexcept -> bool {
+        return (_validity[i / word_size] >> (i % word_size)) & word_type{1};
+    }
+
+    /***
+     * @return the value held by the i-th slot, which is value-initialized if the slot is empty.
+     */
+    auto operator[](std::size_t i) const noexcept -> A const & {
+        return _values[i];
+    }
+
+    /***
+     * @return the i-th slot as an optional<A>.
+     */
+    auto get(std::size_t i) const -> std::optional<A> {
+        return has_value(i) ? std::optional<A>{_values[i]} : std::nullopt;
+    }
+
+    /***
+     * Fills the i-th slot with value.
+     */
+    void set(std::size_t i, A value) {
+        _values[i] = std::move(value);
+        _validity[i / word_size] |= word_type{1} << (i % word_size);
+    }
+
+    /***
+     * Empties the i-th slot.
+     */
+    void reset(std::size_t i) {
+        _values[i] = A{};
+        _validity[i / word_size] &= ~(word_type{1} << (i % word_size));
+    }
+
+    /***
+     * Appends a new slot, which is empty when value is also empty.
+     */
+    template <typename Nullable>
+    void push_back(Nullable &&value) {
+        if (_size % word_size == 0) {
+            _validity.push_back(word_type{0});
+        }
+        if (value) {
+            _values.push_back(*std::forward<Nullable>(value));
+            _validity.back() |= word_type{1} << (_size % word_size);
+        } else {
+            _values.emplace_back();
+        }
+        ++_size;
+    }
+
+    void reserve(std::size_t capacity) {
+        _values.reserve(capacity);
+        _validity.reserve(words_for(capacity));
+    }
+
+    /***
+     * @return the dense array of values, including the value-initialized ones in empty slots.
+     */
+    auto values() const noexcept -> std::vector<A> const & {
+        return _values;
+    }
+
+    /***
+     * @return a pointer to the first of the size() values, which may be modified in place but not resized, such that the
+     * values and the validity bitmap stay in sync.
+     */
+    auto data() noexcept -> A * {
+        return _values.data();
+    }
+
+    auto data() const noexcept -> A const * {
+        return _values.data();
+    }
+
+    /***
+     * @return the validity bitmap, where bits past size() are always unset.
+     */
+    auto validity() const noexcept -> std::vector<word_type> const & {
+        return _validity;
+    }
+
+    /***
+     * @return the number of empty slots.
+     */
+    auto null_count() const noexcept -> std::size_t {
+        std::size_t valid = 0;
+        for (auto word : _validity) {
+            for (; word != 0; word &= word - 1) {
+                ++valid;
+            }
+        }
+        return _size - valid;
+    }
+
+    /***
+     * @return the column as a sequence of optional<A>.
+     */
+    auto to_optionals() const -> std::vector<std::optional<A>> {
+        auto optionals = std::vector<std::optional<A>>{};
+        optionals.reserve(_size);
+        for (std::size_t i = 0; i < _size; ++i) {
+            optionals.push_back(get(i));
+        }
+        return optionals;
+    }
+
+    static constexpr auto words_for(std::size_t size) noexcept -> std::size_t {
+        return (size + word_size - 1) / word_size;
+    }
+
+    friend auto operator==(nullable_column const &lhs, nullable_column const &rhs) -> bool {
+        if (lhs._size != rhs._size || lhs._validity != rhs._validity) {
+            return false;
+        }
+        for (std::size_t i = 0; i < lhs._size; ++i) {
+            if (lhs.has_value(i) && !(lhs._values[i] == rhs._values[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend auto operator!=(nullable_column const &lhs, nullable_column const &rhs) -> bool {
+        return !(lhs == rhs);
+    }
+
+  private:
+    std::vector<A> _values;
+    std::vector<word_type> _validity;
+    std::size_t _size = 0;
+};
+
+/***
+ * Creates a column from a range of optional-like objects.
+ */
+template <typename Range>
+auto from_optionals(Range const &optionals)
+    -> nullable_column<std::decay_t<decltype(*std::declval<typename Range::value_type>())>> {
+    using A = std::decay_t<decltype(*std::declval<typename Range::value_type>())>;
+    return nullable_column<A>(std::begin(optionals), std::end(optionals));
+}
+
+}
+
+namespace rvarago::absent::adapters::column::detail {
+
+constexpr auto count_trailing_zeros(std::uint64_t word) noexcept -> std::size_t {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+    std::size_t count = 0;
+    for (; (word & 1) == 0; word >>= 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/***
+ * Calls action(first, last) for every maximal run [first, last) of consecutive non-empty slots in validity, such that
+ * fully populated words are processed by a single dense loop, while empty words are skipped altogether.
+ */
+template <typename BinaryFunction>
+void for_each_valid_run(std::vector<std::uint64_t> const &validity, BinaryFunction &&action) {
+    constexpr std::size_t word_size = 64;
+    for (std::size_t w = 0; w < validity.size(); ++w) {
+        auto word = validity[w];
+        auto const base = w * word_size;
+        while (word != 0) {
+            auto const first = count_trailing_zeros(word);
+            auto const rest = ~(word >> first);
+            auto const length = rest == 0 ? word_size - first : count_trailing_zeros(rest);
+            action(base + first, base + first + length);
+            word = length + first == word_size ? 0 : word & (~std::uint64_t{0} << (first + length));
+        }
+    }
+}
+
+/***
+ * Calls action(i) for every empty slot i in the first size slots of validity, skipping fully populated words.
+ */
+template <typename UnaryFunction>
+void for_each_empty(std::vector<std::uint64_t> const &validity, std::size_t size, UnaryFunction &&action) {
+    constexpr std::size_t word_size = 64;
+    for (std::size_t w = 0; w < validity.size(); ++w) {
+        auto const base = w * word_size;
+        auto const slots = size - base < word_size ? size - base : word_size;
+        auto const mask = slots == word_size ? ~std::uint64_t{0} : (std::uint64_t{1} << slots) - 1;
+        for (auto word = ~validity[w] & mask; word != 0; word &= word - 1) {
+            action(base + count_trailing_zeros(word));
+        }
+    }
+}
+
+}
+
+#endif
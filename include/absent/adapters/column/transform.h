@@ -0,0 +1,54 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_COLUMN_TRANSFORM_H
+#define RVARAGO_ABSENT_ADAPTERS_COLUMN_TRANSFORM_H
+
+#include "absent/adapters/column/nullable_column.h"
+#include "absent/support/invoke.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::adapters::column {
+
+/***
+ * Given a nullable_column<A>, and an unary function f: A -> B:
+ * - For every empty slot: it should leave the corresponding slot of the new nullable_column<B> empty, without calling
+ * f.
+ * - For every *not* empty slot: it should fill the corresponding slot of the new nullable_column<B> with the result of
+ * calling f with the slot's value of type A.
+ *
+ * Runs of consecutive non-empty slots are mapped by a dense loop, and the validity bitmap is copied as a whole.
+ *
+ * @param input a nullable_column<A>.
+ * @param mapper an unary function A -> B.
+ * @return a new nullable_column containing the mapped values of type B, with the same empty slots as input.
+ */
+template <typename A, typename UnaryFunction>
+auto transform(types::nullable_column<A> const &input, UnaryFunction &&mapper)
+    -> types::nullable_column<
+        std::decay_t<decltype(absent::detail::invoke(std::declval<UnaryFunction>(), std::declval<A>()))>> {
+    using B = std::decay_t<decltype(absent::detail::invoke(mapper, std::declval<A>()))>;
+    auto output = types::nullable_column<B>(input.size(), input.validity());
+    auto const in = input.data();
+    auto const out = output.data();
+    detail::for_each_valid_run(input.validity(), [&](std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            out[i] = absent::detail::invoke(mapper, in[i]);
+        }
+    });
+    return output;
+}
+
+/***
+ * Infix version of transform.
+ */
+template <typename A, typename UnaryFunction>
+auto operator|(types::nullable_column<A> const &input, UnaryFunction &&mapper)
+    -> types::nullable_column<
+        std::decay_t<decltype(absent::detail::invoke(std::declval<UnaryFunction>(), std::declval<A>()))>> {
+    return transform(input, std::forward<UnaryFunction>(mapper));
+}
+
+}
+
+#endif
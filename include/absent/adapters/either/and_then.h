@@ -2,8 +2,11 @@
 #define RVARAGO_ABSENT_ADAPTERS_EITHER_ANDTHEN_H
 
 #include "absent/adapters/either/either.h"
+#include "absent/support/allocator.h"
+#include "absent/support/instrumented.h"
+#include "absent/support/invoke.h"
 
-#include <functional>
+#include <type_traits>
 #include <utility>
 
 namespace rvarago::absent::adapters::either {
@@ -21,14 +24,37 @@ namespace rvarago::absent::adapters::either {
  */
 template <typename A, typename E, typename UnaryFunction>
 constexpr auto and_then(types::either<A, E> const &input,
-                        UnaryFunction &&mapper) noexcept(noexcept(std::invoke(std::declval<UnaryFunction>(),
-                                                                              std::declval<A>())))
-    -> decltype(std::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
-    using EitherB = decltype(std::invoke(mapper, std::declval<A>()));
-    if (auto const p = std::get_if<A>(&input); p) {
-        return std::invoke(std::forward<UnaryFunction>(mapper), *p);
+                        UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                 std::declval<A>())))
+    -> decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
+    using EitherB = decltype(detail::invoke(mapper, std::declval<A>()));
+    if (input.has_value()) {
+        return detail::invoke(std::forward<UnaryFunction>(mapper), *input);
     } else {
-        return EitherB{std::get<E>(input)};
+        if constexpr (detail::is_instrumented_v<std::decay_t<UnaryFunction>>) {
+            mapper.record_short_circuit();
+        }
+        return EitherB{types::in_place_error, detail::copy_with_allocator(input.error())};
+    }
+}
+
+/***
+ * Overload of and_then for an rvalue either<A, E>, whose wrapped value of type A is moved into the mapping function,
+ * or whose error of type E is moved into the new either<B, E>.
+ */
+template <typename A, typename E, typename UnaryFunction>
+constexpr auto and_then(types::either<A, E> &&input,
+                        UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                 std::declval<A>())))
+    -> decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
+    using EitherB = decltype(detail::invoke(mapper, std::declval<A>()));
+    if (input.has_value()) {
+        return detail::invoke(std::forward<UnaryFunction>(mapper), *std::move(input));
+    } else {
+        if constexpr (detail::is_instrumented_v<std::decay_t<UnaryFunction>>) {
+            mapper.record_short_circuit();
+        }
+        return EitherB{types::in_place_error, std::move(input).error()};
     }
 }
 
@@ -37,12 +63,23 @@ constexpr auto and_then(types::either<A, E> const &input,
  */
 template <typename A, typename E, typename UnaryFunction>
 constexpr auto operator>>(types::either<A, E> const &input,
-                          UnaryFunction &&mapper) noexcept(noexcept(std::invoke(std::declval<UnaryFunction>(),
-                                                                                std::declval<A>())))
-    -> decltype(std::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
+                          UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                   std::declval<A>())))
+    -> decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
     return and_then(input, std::forward<UnaryFunction>(mapper));
 }
 
+/***
+ * Infix version of and_then for an rvalue either<A, E>.
+ */
+template <typename A, typename E, typename UnaryFunction>
+constexpr auto operator>>(types::either<A, E> &&input,
+                          UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                   std::declval<A>())))
+    -> decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
+    return and_then(std::move(input), std::forward<UnaryFunction>(mapper));
+}
+
 }
 
 #endif
@@ -0,0 +1,70 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_ASYNC_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_ASYNC_H
+
+#include "absent/adapters/either/either.h"
+#include "absent/adapters/either/fuse.h"
+#include "absent/async.h"
+
+#include <utility>
+
+namespace rvarago::absent::adapters::either {
+
+/***
+ * Given a future of an either<A, E> where E is a type that represents an error, an executor, and an unary function
+ * f: A -> B:
+ * - When in error: it should return a future of a new either<B, E> in error wrapping the error value without scheduling
+ * f.
+ * - When *not* in error: it should schedule f on the executor and return a future of a new either<B, E> wrapping the
+ * result of f.
+ *
+ * @param input a future of an either<A, E>.
+ * @param executor an object whose member function execute(g) eventually invokes g, and which outlives the pipeline.
+ * @param mapper an unary function A -> B.
+ * @return a future of a new either containing the mapped value, possibly in error if input is also in error.
+ */
+template <typename A, typename E, typename Executor, typename UnaryFunction>
+auto transform(support::future<types::either<A, E>> input, Executor &executor, UnaryFunction &&mapper) {
+    return absent::detail::async_transform<absent::detail::fusion<types::either<A, E>>>(
+        std::move(input), executor, std::forward<UnaryFunction>(mapper));
+}
+
+/***
+ * Given a future of an either<A, E> where E is a type that represents an error, an executor, and an unary function f
+ * that is either A -> future<either<B, E>> or A -> either<B, E>:
+ * - When in error: it should return a future of a new either<B, E> in error wrapping the error value without scheduling
+ * f.
+ * - When *not* in error: it should schedule f on the executor and return a future of the either<B, E> eventually
+ * returned by f.
+ *
+ * @param input a future of an either<A, E>.
+ * @param executor an object whose member function execute(g) eventually invokes g, and which outlives the pipeline.
+ * @param mapper an unary function A -> future<either<B, E>> or A -> either<B, E>.
+ * @return a future of the either returned by mapper, possibly in error if input is also in error.
+ */
+template <typename A, typename E, typename Executor, typename UnaryFunction>
+auto and_then(support::future<types::either<A, E>> input, Executor &executor, UnaryFunction &&mapper) {
+    return absent::detail::async_and_then<absent::detail::fusion<types::either<A, E>>>(
+        std::move(input), executor, std::forward<UnaryFunction>(mapper));
+}
+
+/***
+ * Given a future of an either<A, E> where E is a type that represents an error, an executor, and a nullary function
+ * f: void -> A:
+ * - When in error: it should schedule f on the executor and return a future of its result.
+ * - When *not* in error: it should return a future of the wrapped value without scheduling f.
+ *
+ * @param input a future of an either<A, E>.
+ * @param executor an object whose member function execute(g) eventually invokes g, and which outlives the pipeline.
+ * @param fallback a nullary function void -> A.
+ * @return a future of the value wrapped inside input, or of the result of fallback if input is in error.
+ */
+template <typename A, typename E, typename Executor, typename NullaryFunction>
+auto eval(support::future<types::either<A, E>> input, Executor &executor, NullaryFunction &&fallback)
+    -> support::future<A> {
+    return absent::detail::async_eval<absent::detail::fusion<types::either<A, E>>>(
+        std::move(input), executor, std::forward<NullaryFunction>(fallback));
+}
+
+}
+
+#endif
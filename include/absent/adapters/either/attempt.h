@@ -2,9 +2,11 @@
 #define RVARAGO_ABSENT_ADAPTERS_EITHER_ATTEMPT_H
 
 #include "absent/adapters/either/either.h"
+#include "absent/support/invoke.h"
 
 #include <exception>
-#include <functional>
+#include <memory>
+#include <string>
 #include <utility>
 
 namespace rvarago::absent::adapters::either {
@@ -20,12 +22,37 @@ namespace rvarago::absent::adapters::either {
  */
 template <typename BaseException = std::exception, typename NullaryFunction>
 auto attempt(NullaryFunction &&unsafe)
-    -> types::either<decltype(std::invoke(std::declval<NullaryFunction>())), BaseException> {
-    using EitherA = types::either<decltype(std::invoke(unsafe)), BaseException>;
+    -> types::either<decltype(detail::invoke(std::declval<NullaryFunction>())), BaseException> {
+    using EitherA = types::either<decltype(detail::invoke(unsafe)), BaseException>;
     try {
-        return EitherA{std::invoke(std::forward<NullaryFunction>(unsafe))};
+        return EitherA{types::in_place_value, detail::invoke(std::forward<NullaryFunction>(unsafe))};
     } catch (BaseException const &ex) {
-        return EitherA{ex};
+        return EitherA{types::in_place_error, ex};
+    }
+}
+
+/***
+ * Overload of attempt that, when f throws, returns an invalid either<A, S> wrapping the message of the exception, i.e.
+ * what(), as a string S allocated with allocator rather than the global heap, e.g. a std::pmr::string in a
+ * per-request arena via std::pmr::polymorphic_allocator<char>, which is then freed at once with the arena.
+ *
+ * @param allocator the allocator of the message.
+ * @param unsafe a nullary function () -> A that may throw.
+ * @return a new either wrapping the value returned by unsafe, possibly invalid with the message of the exception if
+ * unsafe threw.
+ */
+template <typename BaseException = std::exception, typename Allocator, typename NullaryFunction>
+auto attempt(std::allocator_arg_t, Allocator const &allocator, NullaryFunction &&unsafe)
+    -> types::either<decltype(detail::invoke(std::declval<NullaryFunction>())),
+                     std::basic_string<char, std::char_traits<char>,
+                                       typename std::allocator_traits<Allocator>::template rebind_alloc<char>>> {
+    using Message = std::basic_string<char, std::char_traits<char>,
+                                      typename std::allocator_traits<Allocator>::template rebind_alloc<char>>;
+    using EitherA = types::either<decltype(detail::invoke(unsafe)), Message>;
+    try {
+        return EitherA{types::in_place_value, detail::invoke(std::forward<NullaryFunction>(unsafe))};
+    } catch (BaseException const &ex) {
+        return EitherA{std::allocator_arg, allocator, types::in_place_error, ex.what()};
     }
 }
 
@@ -0,0 +1,57 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_BATCH_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_BATCH_H
+
+#include "absent/adapters/either/and_then.h"
+#include "absent/adapters/either/transform.h"
+#include "absent/batch.h"
+
+#include <algorithm>
+#include <execution>
+#include <iterator>
+#include <utility>
+
+namespace rvarago::absent::adapters::either {
+
+/***
+ * Batch version of transform, which applies transform to every either<A, E> in inputs under an execution policy,
+ * e.g. std::execution::par, and writes the resulting either<B, E> into the preallocated outputs.
+ *
+ * Since mapper may be called concurrently when policy allows it, it must be safe to do so.
+ *
+ * @param policy an execution policy.
+ * @param inputs a range of either<A, E>.
+ * @param outputs a range of either<B, E> at least as large as inputs.
+ * @param mapper an unary function A -> B.
+ * @return an iterator to the element in outputs past the last one written.
+ */
+template <typename ExecutionPolicy, typename InputRange, typename OutputRange, typename UnaryFunction,
+          typename = absent::detail::enable_if_execution_policy<ExecutionPolicy>>
+auto transform(ExecutionPolicy &&policy, InputRange const &inputs, OutputRange &outputs, UnaryFunction const &mapper)
+    -> decltype(std::begin(outputs)) {
+    return std::transform(std::forward<ExecutionPolicy>(policy), std::begin(inputs), std::end(inputs),
+                          std::begin(outputs), [&mapper](auto const &input) { return transform(input, mapper); });
+}
+
+/***
+ * Batch version of and_then, which applies and_then to every either<A, E> in inputs under an execution policy,
+ * e.g. std::execution::par, and writes the resulting either<B, E> into the preallocated outputs.
+ *
+ * Since mapper may be called concurrently when policy allows it, it must be safe to do so.
+ *
+ * @param policy an execution policy.
+ * @param inputs a range of either<A, E>.
+ * @param outputs a range of either<B, E> at least as large as inputs.
+ * @param mapper an unary function A -> either<B, E>.
+ * @return an iterator to the element in outputs past the last one written.
+ */
+template <typename ExecutionPolicy, typename InputRange, typename OutputRange, typename UnaryFunction,
+          typename = absent::detail::enable_if_execution_policy<ExecutionPolicy>>
+auto and_then(ExecutionPolicy &&policy, InputRange const &inputs, OutputRange &outputs, UnaryFunction const &mapper)
+    -> decltype(std::begin(outputs)) {
+    return std::transform(std::forward<ExecutionPolicy>(policy), std::begin(inputs), std::end(inputs),
+                          std::begin(outputs), [&mapper](auto const &input) { return and_then(input, mapper); });
+}
+
+}
+
+#endif
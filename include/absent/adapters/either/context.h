@@ -0,0 +1,324 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_CONTEXT_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_CONTEXT_H
+
+#include "absent/adapters/either/either.h"
+#include "absent/support/invoke.h"
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::adapters::types {
+
+class literal;
+
+inline namespace literals {
+
+constexpr auto operator""_lit(char const *text, std::size_t) noexcept -> literal;
+
+}
+
+/**
+ * A string literal, which has static storage duration, hence a frame of context may store it by pointer and format it
+ * much later. It can only be created by the user-defined literal _lit, e.g. "user {} not found"_lit, such that a char
+ * array that may dangle by the time the error is formatted, e.g. a local char name[32], is rejected at compile-time.
+ */
+class literal final {
+    char const *_text;
+
+    constexpr explicit literal(char const *text) noexcept : _text{text} {
+    }
+
+    friend constexpr auto literals::operator""_lit(char const *text, std::size_t) noexcept -> literal;
+
+  public:
+    constexpr auto c_str() const noexcept -> char const * {
+        return _text;
+    }
+};
+
+inline namespace literals {
+
+constexpr auto operator""_lit(char const *text, std::size_t) noexcept -> literal {
+    return literal{text};
+}
+
+}
+
+namespace detail {
+
+enum class argument_kind : unsigned char { none, signed_integer, unsigned_integer, floating, literal };
+
+/**
+ * An argument captured by a frame of context, stored as a raw word plus its kind, such that it's trivially copyable.
+ */
+struct argument final {
+    std::uint64_t word;
+    argument_kind kind;
+};
+
+template <typename T>
+auto capture(T const &value) noexcept -> argument {
+    if constexpr (std::is_enum_v<T>) {
+        return capture(static_cast<std::underlying_type_t<T>>(value));
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return argument{static_cast<std::uint64_t>(value), argument_kind::unsigned_integer};
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        return argument{static_cast<std::uint64_t>(static_cast<std::int64_t>(value)), argument_kind::signed_integer};
+    } else if constexpr (std::is_integral_v<T>) {
+        return argument{static_cast<std::uint64_t>(value), argument_kind::unsigned_integer};
+    } else {
+        static_assert(std::is_floating_point_v<T>,
+                      "Context may only capture integers, enums, floating point numbers, and literals made by _lit");
+        auto const as_double = static_cast<double>(value);
+        auto word = std::uint64_t{};
+        std::memcpy(&word, &as_double, sizeof(word));
+        return argument{word, argument_kind::floating};
+    }
+}
+
+/**
+ * String literals are captured by pointer, which stays valid since they have static storage duration.
+ */
+inline auto capture(types::literal const &text) noexcept -> argument {
+    return argument{reinterpret_cast<std::uintptr_t>(text.c_str()), argument_kind::literal};
+}
+
+inline auto append(std::string &out, argument const &arg) -> void {
+    auto buffer = std::array<char, 32>{};
+    auto result = std::to_chars_result{buffer.data(), std::errc{}};
+    switch (arg.kind) {
+    case argument_kind::none:
+        return;
+    case argument_kind::signed_integer:
+        result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), static_cast<std::int64_t>(arg.word));
+        break;
+    case argument_kind::unsigned_integer:
+        result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), arg.word);
+        break;
+    case argument_kind::floating: {
+        auto value = double{};
+        std::memcpy(&value, &arg.word, sizeof(value));
+        result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        break;
+    }
+    case argument_kind::literal:
+        out += reinterpret_cast<char const *>(static_cast<std::uintptr_t>(arg.word));
+        return;
+    }
+    out.append(buffer.data(), result.ptr);
+}
+
+inline constexpr std::size_t max_arguments = 2;
+
+/**
+ * The kinds of the arguments of a frame, packed into a single byte, since they only take a few bits each.
+ */
+using packed_kinds = std::uint8_t;
+
+constexpr auto pack(argument_kind first, argument_kind second) noexcept -> packed_kinds {
+    return static_cast<packed_kinds>(static_cast<unsigned>(first) | static_cast<unsigned>(second) << 4u);
+}
+
+constexpr auto unpack(packed_kinds kinds, std::size_t index) noexcept -> argument_kind {
+    return static_cast<argument_kind>((kinds >> (4u * index)) & 0xFu);
+}
+
+/**
+ * The words of a frame of context: a format string literal where each "{}" is replaced by the next captured argument,
+ * whose kinds are stored apart, such that it takes three words without any padding.
+ */
+struct frame_words final {
+    char const *format;
+    std::array<std::uint64_t, max_arguments> words;
+
+    auto append_to(std::string &out, packed_kinds kinds) const -> void {
+        auto format_view = std::string_view{format};
+        auto next = std::size_t{0};
+        for (auto placeholder = format_view.find("{}"); placeholder != std::string_view::npos && next < max_arguments;
+             placeholder = format_view.find("{}")) {
+            out.append(format_view.data(), placeholder);
+            append(out, argument{words[next], unpack(kinds, next)});
+            ++next;
+            format_view.remove_prefix(placeholder + 2);
+        }
+        out.append(format_view.data(), format_view.size());
+    }
+};
+
+/**
+ * A frame of context, as captured before it's added to an error.
+ */
+struct frame final {
+    frame_words words;
+    packed_kinds kinds;
+};
+
+template <typename... Args>
+auto make_frame(literal format, Args const &... args) noexcept -> frame {
+    static_assert(sizeof...(Args) <= max_arguments, "A frame of context may capture at most two arguments");
+    auto const arguments = std::array<argument, max_arguments>{capture(args)...};
+    return frame{{format.c_str(), {arguments[0].word, arguments[1].word}},
+                 pack(arguments[0].kind, arguments[1].kind)};
+}
+
+}
+
+/**
+ * An error made of a compact code of type Code, e.g. an enum, and up to Depth frames of context, where each frame is a
+ * format string literal plus up to two captured arguments: integers, enums, floating point numbers, or string literals,
+ * where every string literal is made by _lit, e.g. "user {} not found"_lit, since it's stored by pointer.
+ *
+ * The first frame describes the error itself, and each following one the context where it happened, as added by
+ * adapters::either::with_context or adapters::either::in_context, e.g. "user 42 not found, while loading user 42 from
+ * shard 7". The frames beyond Depth are counted, but dropped.
+ *
+ * Nothing is formatted until message() is called, and it's trivially copyable and never allocates. Yet, it's moved
+ * along with every stage of a chain, and each frame takes three words plus a byte, hence Depth is small by default, such
+ * that e.g. a contextual_error of an enum takes 64 bytes.
+ */
+template <typename Code, std::size_t Depth = 2>
+class contextual_error final {
+    static_assert(Depth > 0, "There must be room for at least one frame");
+    static_assert(std::is_trivially_copyable_v<Code>, "Code must be trivially copyable");
+
+    std::array<detail::frame_words, Depth> _frames;
+    std::array<detail::packed_kinds, Depth> _kinds;
+    Code _code;
+    std::uint16_t _depth;
+    std::uint16_t _dropped;
+
+  public:
+    using code_type = Code;
+
+    /**
+     * Creates an error with the code and a first frame describing it, e.g. contextual_error{code, "user {} not
+     * found"_lit, id}.
+     */
+    template <typename... Args>
+    contextual_error(Code code, literal format, Args const &... args) noexcept
+        : _frames{}, _kinds{}, _code{code}, _depth{1}, _dropped{0} {
+        auto const frame = detail::make_frame(format, args...);
+        _frames[0] = frame.words;
+        _kinds[0] = frame.kinds;
+    }
+
+    constexpr auto code() const noexcept -> Code {
+        return _code;
+    }
+
+    /**
+     * @return how many frames have been added, including the dropped ones.
+     */
+    constexpr auto depth() const noexcept -> std::size_t {
+        return std::size_t{_depth} + _dropped;
+    }
+
+    /**
+     * @return a copy of this error with a new frame of context, which is dropped when there are already Depth frames.
+     */
+    template <typename... Args>
+    auto with_context(literal format, Args const &... args) const noexcept -> contextual_error {
+        return with_context(detail::make_frame(format, args...));
+    }
+
+    /**
+     * Overload of with_context for a frame that has already been captured.
+     */
+    auto with_context(detail::frame const &frame) const noexcept -> contextual_error {
+        auto copy = *this;
+        if (copy._depth < Depth) {
+            copy._frames[copy._depth] = frame.words;
+            copy._kinds[copy._depth] = frame.kinds;
+            ++copy._depth;
+        } else {
+            ++copy._dropped;
+        }
+        return copy;
+    }
+
+    /**
+     * Formats the frames, separated by a comma, e.g. "user 42 not found, while loading user 42 from shard 7".
+     */
+    auto message() const -> std::string {
+        auto out = std::string{};
+        for (std::size_t i = 0; i < _depth; ++i) {
+            if (i > 0) {
+                out += ", ";
+            }
+            _frames[i].append_to(out, _kinds[i]);
+        }
+        if (_dropped > 0) {
+            out += ", and ";
+            detail::append(out, detail::capture(_dropped));
+            out += " more";
+        }
+        return out;
+    }
+
+    /**
+     * @return whether both errors have the same code, regardless of their context.
+     */
+    constexpr auto same_code(contextual_error const &other) const noexcept -> bool {
+        return _code == other._code;
+    }
+};
+
+}
+
+namespace rvarago::absent::adapters::either {
+
+/***
+ * Given an either<A, contextual_error<Code, Depth>>, and a format string literal with up to two arguments:
+ * - When in error: it should return a new either<A, contextual_error<Code, Depth>> in error wrapping the error with a
+ * new frame of context, e.g. "while loading user {} from shard {}", without formatting it.
+ * - When *not* in error: it should return the input as-is.
+ *
+ * @param input an either<A, contextual_error<Code, Depth>>.
+ * @param format a format string literal made by _lit, where each "{}" is replaced by the next argument.
+ * @param args up to two integers, enums, floating point numbers, or string literals made by _lit.
+ * @return a new either holding the value of the input, or its error with the new frame of context.
+ */
+template <typename A, typename Code, std::size_t Depth, typename... Args>
+auto with_context(types::either<A, types::contextual_error<Code, Depth>> input, types::literal format,
+                  Args const &... args) -> types::either<A, types::contextual_error<Code, Depth>> {
+    if (!input.has_value()) {
+        input.error() = input.error().with_context(format, args...);
+    }
+    return input;
+}
+
+/***
+ * Given an unary function f: A -> either<B, contextual_error<Code, Depth>>, and a format string literal with up to two
+ * arguments, it returns a new function A -> either<B, contextual_error<Code, Depth>> that adds a frame of context to
+ * the errors returned by f, e.g. input >> in_context(load_user, "while loading user {} from shard {}", id, shard).
+ *
+ * The arguments are captured by value once, when the function is created, but they're neither formatted nor stored into
+ * an error unless f fails.
+ *
+ * @param mapper an unary function A -> either<B, contextual_error<Code, Depth>>.
+ * @param format a format string literal made by _lit, where each "{}" is replaced by the next argument.
+ * @param args up to two integers, enums, floating point numbers, or string literals made by _lit.
+ * @return a new function A -> either<B, contextual_error<Code, Depth>>.
+ */
+template <typename UnaryFunction, typename... Args>
+auto in_context(UnaryFunction &&mapper, types::literal format, Args const &... args) {
+    return [mapper = std::forward<UnaryFunction>(mapper),
+            frame = types::detail::make_frame(format, args...)](auto &&value) {
+        auto result = detail::invoke(mapper, std::forward<decltype(value)>(value));
+        if (!result.has_value()) {
+            result.error() = result.error().with_context(frame);
+        }
+        return result;
+    };
+}
+
+}
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_COROUTINE_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_COROUTINE_H
+
+#include "absent/adapters/either/fuse.h"
+#include "absent/coroutine.h"
+
+#ifdef RVARAGO_ABSENT_HAS_COROUTINES
+
+namespace rvarago::absent::adapters::either {
+
+/***
+ * The result of a coroutine that evaluates to an either<B, E>, where every co_await on an either<A, E>:
+ * - When in error: it should stop the coroutine and make it evaluate to a new either<B, E> in error wrapping the error
+ * value, destroying the values in scope.
+ * - When *not* in error: it should evaluate to the wrapped value of type A, which is moved out of an rvalue
+ * either<A, E>.
+ */
+using absent::block;
+
+}
+
+#endif
+
+#endif
@@ -1,11 +1,397 @@
 #ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_H
 #define RVARAGO_ABSENT_ADAPTERS_EITHER_H
 
-#include <variant>
+#include "absent/support/allocator.h"
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace rvarago::absent::adapters::types {
+
+/**
+ * Tag to construct an either<A, E> holding a value of type A in-place.
+ */
+struct in_place_value_t final {
+    explicit in_place_value_t() = default;
+};
+
+inline constexpr auto in_place_value = in_place_value_t{};
+
+/**
+ * Tag to construct an either<A, E> holding an error of type E in-place.
+ */
+struct in_place_error_t final {
+    explicit in_place_error_t() = default;
+};
+
+inline constexpr auto in_place_error = in_place_error_t{};
+
+namespace detail {
+
+template <typename T>
+using remove_cvref_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+template <typename T>
+void initialize_array_of(T (&&)[1]);
+
+/**
+ * Whether U converts to T without narrowing, i.e. T x[] = {u} is well-formed, and, unless U is itself a bool, T is not
+ * a bool. As with std::variant, such a conversion is preferred when picking between the value and the error.
+ */
+template <typename T, typename U, typename = void>
+inline constexpr bool is_exactly_convertible_v = false;
+
+template <typename T, typename U>
+inline constexpr bool
+    is_exactly_convertible_v<T, U, std::void_t<decltype(initialize_array_of<T>({std::declval<U>()}))>> =
+        std::is_convertible_v<U, T> &&
+        (!std::is_same_v<std::remove_cv_t<T>, bool> || std::is_same_v<remove_cvref_t<U>, bool>);
+
+/**
+ * Storage of an either<A, E> when both A and E are trivially copyable, and so is the storage.
+ */
+template <typename A, typename E>
+struct trivial_storage {
+    union {
+        A _value;
+        E _error;
+    };
+    bool _has_value;
+
+    template <typename... Args>
+    constexpr explicit trivial_storage(in_place_value_t, Args &&... args)
+        : _value(std::forward<Args>(args)...), _has_value{true} {
+    }
+
+    template <typename... Args>
+    constexpr explicit trivial_storage(in_place_error_t, Args &&... args)
+        : _error(std::forward<Args>(args)...), _has_value{false} {
+    }
+};
+
+/**
+ * Destroys old and constructs new_ from args in its place, such that when constructing new_ throws, old is restored.
+ */
+template <typename New, typename Old, typename... Args>
+void reinitialize(New *new_, Old *old, Args &&... args) {
+    if constexpr (std::is_nothrow_constructible_v<New, Args...>) {
+        old->~Old();
+        ::new (static_cast<void *>(new_)) New(std::forward<Args>(args)...);
+    } else if constexpr (std::is_nothrow_move_constructible_v<New>) {
+        New temporary(std::forward<Args>(args)...);
+        old->~Old();
+        ::new (static_cast<void *>(new_)) New(std::move(temporary));
+    } else {
+        static_assert(std::is_nothrow_move_constructible_v<Old>,
+                      "Either A or E must be nothrow move constructible to assign an either<A, E>");
+        Old temporary(std::move(*old));
+        old->~Old();
+        try {
+            ::new (static_cast<void *>(new_)) New(std::forward<Args>(args)...);
+        } catch (...) {
+            ::new (static_cast<void *>(old)) Old(std::move(temporary));
+            throw;
+        }
+    }
+}
+
+/**
+ * Storage of an either<A, E> when either A or E is not trivially copyable.
+ */
 template <typename A, typename E>
-using either = std::variant<A, E>;
+struct non_trivial_storage {
+    union {
+        A _value;
+        E _error;
+    };
+    bool _has_value;
+
+    template <typename... Args>
+    constexpr explicit non_trivial_storage(in_place_value_t, Args &&... args)
+        : _value(std::forward<Args>(args)...), _has_value{true} {
+    }
+
+    template <typename... Args>
+    constexpr explicit non_trivial_storage(in_place_error_t, Args &&... args)
+        : _error(std::forward<Args>(args)...), _has_value{false} {
+    }
+
+    non_trivial_storage(non_trivial_storage const &other) noexcept(
+        std::is_nothrow_copy_constructible_v<A> &&std::is_nothrow_copy_constructible_v<E>)
+        : _has_value{other._has_value} {
+        if (_has_value) {
+            ::new (static_cast<void *>(std::addressof(_value))) A(other._value);
+        } else {
+            ::new (static_cast<void *>(std::addressof(_error))) E(other._error);
+        }
+    }
+
+    non_trivial_storage(non_trivial_storage &&other) noexcept(
+        std::is_nothrow_move_constructible_v<A> &&std::is_nothrow_move_constructible_v<E>)
+        : _has_value{other._has_value} {
+        if (_has_value) {
+            ::new (static_cast<void *>(std::addressof(_value))) A(std::move(other._value));
+        } else {
+            ::new (static_cast<void *>(std::addressof(_error))) E(std::move(other._error));
+        }
+    }
+
+    auto operator=(non_trivial_storage const &other) -> non_trivial_storage & {
+        if (_has_value && other._has_value) {
+            _value = other._value;
+        } else if (!_has_value && !other._has_value) {
+            _error = other._error;
+        } else if (_has_value) {
+            reinitialize(std::addressof(_error), std::addressof(_value), other._error);
+            _has_value = false;
+        } else {
+            reinitialize(std::addressof(_value), std::addressof(_error), other._value);
+            _has_value = true;
+        }
+        return *this;
+    }
+
+    auto operator=(non_trivial_storage &&other) noexcept(
+        std::is_nothrow_move_constructible_v<A> &&std::is_nothrow_move_assignable_v<A>
+            &&std::is_nothrow_move_constructible_v<E> &&std::is_nothrow_move_assignable_v<E>) -> non_trivial_storage & {
+        if (_has_value && other._has_value) {
+            _value = std::move(other._value);
+        } else if (!_has_value && !other._has_value) {
+            _error = std::move(other._error);
+        } else if (_has_value) {
+            reinitialize(std::addressof(_error), std::addressof(_value), std::move(other._error));
+            _has_value = false;
+        } else {
+            reinitialize(std::addressof(_value), std::addressof(_error), std::move(other._value));
+            _has_value = true;
+        }
+        return *this;
+    }
+
+    ~non_trivial_storage() {
+        if (_has_value) {
+            _value.~A();
+        } else {
+            _error.~E();
+        }
+    }
+};
+
+template <typename A, typename E>
+using storage = std::conditional_t<std::is_trivially_copyable_v<A> && std::is_trivially_copyable_v<E>,
+                                   trivial_storage<A, E>, non_trivial_storage<A, E>>;
+
+/**
+ * Deletes the copy operations of an either<A, E> when either A or E is not copyable.
+ */
+template <bool Copyable>
+struct copy_control {};
+
+template <>
+struct copy_control<false> {
+    copy_control() = default;
+    copy_control(copy_control const &) = delete;
+    copy_control(copy_control &&) = default;
+    auto operator=(copy_control const &) -> copy_control & = delete;
+    auto operator=(copy_control &&) -> copy_control & = default;
+};
+
+}
+
+/**
+ * Holds either a value of type A or, by convention, an error of type E.
+ *
+ * Unlike std::variant<A, E>, it's never valueless, it's trivially copyable whenever both A and E are, and it keeps
+ * whether it holds a value in a single flag, such that once it has been checked, the value or the error may be accessed
+ * without further checks.
+ */
+template <typename A, typename E>
+class either final : private detail::storage<A, E>,
+                     private detail::copy_control<std::is_copy_constructible_v<A> && std::is_copy_constructible_v<E>> {
+    using base = detail::storage<A, E>;
+
+    // An allocator is never converted into a value or an error, but only passed by uses-allocator construction through
+    // the allocator-extended constructors.
+    template <typename U>
+    static constexpr bool is_either_or_tag_v =
+        std::is_same_v<detail::remove_cvref_t<U>, either> ||
+        std::is_same_v<detail::remove_cvref_t<U>, in_place_value_t> ||
+        std::is_same_v<detail::remove_cvref_t<U>, in_place_error_t> ||
+        absent::detail::is_allocator_v<detail::remove_cvref_t<U>>;
+
+    // Like std::variant<A, E>, it only converts implicitly from what converts implicitly to A or E, hence e.g. an int
+    // doesn't become an error of type std::vector<int> through its explicit constructor. When U converts to both, it
+    // prefers the one that U converts to without narrowing nor becoming a bool, e.g. a string literal becomes an error of
+    // type std::string rather than a value of type bool, and A otherwise.
+    template <typename U>
+    static constexpr bool prefers_error_v =
+        detail::is_exactly_convertible_v<E, U &&> && !detail::is_exactly_convertible_v<A, U &&>;
+
+    template <typename U>
+    static constexpr bool is_value_v = !std::is_same_v<A, E> && !is_either_or_tag_v<U> &&
+                                       std::is_convertible_v<U &&, A> &&
+                                       !std::is_same_v<detail::remove_cvref_t<U>, E> && !prefers_error_v<U>;
+
+    template <typename U>
+    static constexpr bool is_error_v =
+        !std::is_same_v<A, E> && !is_either_or_tag_v<U> && std::is_convertible_v<U &&, E> &&
+        (std::is_same_v<detail::remove_cvref_t<U>, E> || !std::is_convertible_v<U &&, A> || prefers_error_v<U>);
+
+  public:
+    using value_type = A;
+    using error_type = E;
+
+    /**
+     * Creates an either holding a value-initialized A.
+     */
+    template <typename U = A, std::enable_if_t<std::is_default_constructible_v<U>, int> = 0>
+    constexpr either() noexcept(std::is_nothrow_default_constructible_v<A>) : base{in_place_value} {
+    }
+
+    /**
+     * Creates an either holding a value of type A converted from value, when it's unambiguously an A.
+     */
+    template <typename U, std::enable_if_t<is_value_v<U>, int> = 0>
+    constexpr either(U &&value) noexcept(std::is_nothrow_constructible_v<A, U &&>)
+        : base{in_place_value, std::forward<U>(value)} {
+    }
+
+    /**
+     * Creates an either holding an error of type E converted from error, when it's unambiguously an E.
+     */
+    template <typename U, std::enable_if_t<is_error_v<U>, int> = 0>
+    constexpr either(U &&error) noexcept(std::is_nothrow_constructible_v<E, U &&>)
+        : base{in_place_error, std::forward<U>(error)} {
+    }
+
+    template <typename... Args>
+    constexpr explicit either(in_place_value_t, Args &&... args) noexcept(
+        std::is_nothrow_constructible_v<A, Args &&...>)
+        : base{in_place_value, std::forward<Args>(args)...} {
+    }
+
+    template <typename... Args>
+    constexpr explicit either(in_place_error_t, Args &&... args) noexcept(
+        std::is_nothrow_constructible_v<E, Args &&...>)
+        : base{in_place_error, std::forward<Args>(args)...} {
+    }
+
+    /**
+     * Allocator-extended constructors, which create the value of type A or the error of type E by uses-allocator
+     * construction, e.g. such that a std::pmr::string error is allocated in a caller-provided memory resource.
+     *
+     * Together with the specialisation of std::uses_allocator, they let allocator-aware containers, such as
+     * std::pmr::vector<either<A, E>>, pass their allocators to the values or the errors of their elements.
+     */
+    template <typename Allocator, typename U = A, std::enable_if_t<std::is_default_constructible_v<U>, int> = 0>
+    either(std::allocator_arg_t, Allocator const &allocator) : either{std::allocator_arg, allocator, in_place_value} {
+    }
+
+    template <typename Allocator, typename... Args>
+    explicit either(std::allocator_arg_t, Allocator const &allocator, in_place_value_t, Args &&... args)
+        : base{in_place_value, absent::detail::make_using_allocator<A>(allocator, std::forward<Args>(args)...)} {
+    }
+
+    template <typename Allocator, typename... Args>
+    explicit either(std::allocator_arg_t, Allocator const &allocator, in_place_error_t, Args &&... args)
+        : base{in_place_error, absent::detail::make_using_allocator<E>(allocator, std::forward<Args>(args)...)} {
+    }
+
+    template <typename Allocator, typename U, std::enable_if_t<is_value_v<U>, int> = 0>
+    either(std::allocator_arg_t, Allocator const &allocator, U &&value)
+        : either{std::allocator_arg, allocator, in_place_value, std::forward<U>(value)} {
+    }
+
+    template <typename Allocator, typename U, std::enable_if_t<is_error_v<U>, int> = 0>
+    either(std::allocator_arg_t, Allocator const &allocator, U &&error)
+        : either{std::allocator_arg, allocator, in_place_error, std::forward<U>(error)} {
+    }
+
+    template <typename Allocator>
+    either(std::allocator_arg_t, Allocator const &allocator, either const &other)
+        : base(other.has_value()
+                   ? base{in_place_value, absent::detail::make_using_allocator<A>(allocator, *other)}
+                   : base{in_place_error, absent::detail::make_using_allocator<E>(allocator, other.error())}) {
+    }
+
+    template <typename Allocator>
+    either(std::allocator_arg_t, Allocator const &allocator, either &&other)
+        : base(other.has_value() ? base{in_place_value,
+                                        absent::detail::make_using_allocator<A>(allocator, *std::move(other))}
+                                 : base{in_place_error, absent::detail::make_using_allocator<E>(
+                                                            allocator, std::move(other).error())}) {
+    }
+
+    /**
+     * @return whether it holds a value of type A rather than an error of type E.
+     */
+    constexpr auto has_value() const noexcept -> bool {
+        return this->_has_value;
+    }
+
+    /**
+     * Unchecked access to the value of type A, which must be held.
+     */
+    constexpr auto operator*() const &noexcept -> A const & {
+        return this->_value;
+    }
+
+    constexpr auto operator*() &noexcept -> A & {
+        return this->_value;
+    }
+
+    constexpr auto operator*() &&noexcept -> A && {
+        return std::move(this->_value);
+    }
+
+    constexpr auto operator->() const noexcept -> A const * {
+        return std::addressof(this->_value);
+    }
+
+    constexpr auto operator->() noexcept -> A * {
+        return std::addressof(this->_value);
+    }
+
+    /**
+     * Unchecked access to the error of type E, which must be held.
+     */
+    constexpr auto error() const &noexcept -> E const & {
+        return this->_error;
+    }
+
+    constexpr auto error() &noexcept -> E & {
+        return this->_error;
+    }
+
+    constexpr auto error() &&noexcept -> E && {
+        return std::move(this->_error);
+    }
+
+    friend constexpr auto operator==(either const &lhs, either const &rhs) -> bool {
+        if (lhs.has_value() != rhs.has_value()) {
+            return false;
+        }
+        return lhs.has_value() ? *lhs == *rhs : lhs.error() == rhs.error();
+    }
+
+    friend constexpr auto operator!=(either const &lhs, either const &rhs) -> bool {
+        return !(lhs == rhs);
+    }
+};
+
+}
+
+namespace std {
+
+/**
+ * An either<A, E> uses an allocator whenever either A or E does.
+ */
+template <typename A, typename E, typename Allocator>
+struct uses_allocator<rvarago::absent::adapters::types::either<A, E>, Allocator>
+    : bool_constant<uses_allocator_v<A, Allocator> || uses_allocator_v<E, Allocator>> {};
+
 }
 
 #endif
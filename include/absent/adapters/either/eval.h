@@ -2,8 +2,8 @@
 #define RVARAGO_ABSENT_ADAPTERS_EITHER_EVAL_H
 
 #include "absent/adapters/either/either.h"
+#include "absent/support/invoke.h"
 
-#include <functional>
 #include <utility>
 
 namespace rvarago::absent::adapters::either {
@@ -18,12 +18,25 @@ namespace rvarago::absent::adapters::either {
  * @return the wrapped value inside the either or the result of fallback if the either is in error.
  */
 template <typename NullaryFunction, typename A, typename E>
-constexpr auto eval(types::either<A, E> const &input,
-                    NullaryFunction &&fallback) noexcept(noexcept(std::invoke(std::declval<NullaryFunction>()))) -> A {
-    if (!std::holds_alternative<A>(input)) {
-        return std::invoke(std::forward<NullaryFunction>(fallback));
+constexpr auto eval(types::either<A, E> const &input, NullaryFunction &&fallback) noexcept(
+    noexcept(detail::invoke(std::declval<NullaryFunction>()))) -> A {
+    if (!input.has_value()) {
+        return detail::invoke(std::forward<NullaryFunction>(fallback));
     } else {
-        return std::get<A>(input);
+        return *input;
+    }
+}
+
+/***
+ * Overload of eval for an rvalue either<A, E>, whose wrapped value of type A is moved out instead of copied.
+ */
+template <typename NullaryFunction, typename A, typename E>
+constexpr auto eval(types::either<A, E> &&input, NullaryFunction &&fallback) noexcept(
+    noexcept(detail::invoke(std::declval<NullaryFunction>()))) -> A {
+    if (!input.has_value()) {
+        return detail::invoke(std::forward<NullaryFunction>(fallback));
+    } else {
+        return *std::move(input);
     }
 }
 
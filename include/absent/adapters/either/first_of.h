@@ -0,0 +1,20 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_FIRSTOF_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_FIRSTOF_H
+
+#include "absent/adapters/either/fuse.h"
+#include "absent/first_of.h"
+
+namespace rvarago::absent::adapters::either {
+
+/***
+ * Given the nullary functions f1: void -> either<A, E>, ..., fn: void -> either<A, E>, optionally preceded by an
+ * executor and a delay to hedge them:
+ * - When any of them returns an either not in error: it should return it, or satisfy the returned future with it, and
+ * skip or cancel the remaining functions.
+ * - When all of them return an either in error: it should return the either in error returned by the last one.
+ */
+using absent::first_of;
+
+}
+
+#endif
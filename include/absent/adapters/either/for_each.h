@@ -2,8 +2,10 @@
 #define RVARAGO_ABSENT_ADAPTERS_EITHER_FOREACH_H
 
 #include "absent/adapters/either/either.h"
+#include "absent/support/instrumented.h"
+#include "absent/support/invoke.h"
 
-#include <functional>
+#include <type_traits>
 #include <utility>
 
 namespace rvarago::absent::adapters::either {
@@ -18,10 +20,26 @@ namespace rvarago::absent::adapters::either {
  */
 template <typename UnaryFunction, typename A, typename E>
 constexpr auto for_each(types::either<A, E> const &input,
-                        UnaryFunction &&action) noexcept(noexcept(std::invoke(std::declval<UnaryFunction>(),
-                                                                              std::declval<A>()))) -> void {
-    if (auto const p = std::get_if<A>(&input); p) {
-        std::invoke(std::forward<UnaryFunction>(action), *p);
+                        UnaryFunction &&action) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                 std::declval<A>()))) -> void {
+    if (input.has_value()) {
+        detail::invoke(std::forward<UnaryFunction>(action), *input);
+    } else if constexpr (detail::is_instrumented_v<std::decay_t<UnaryFunction>>) {
+        action.record_short_circuit();
+    }
+}
+
+/***
+ * Overload of for_each for an rvalue either<A, E>, whose wrapped value of type A is moved into the action.
+ */
+template <typename UnaryFunction, typename A, typename E>
+constexpr auto for_each(types::either<A, E> &&input,
+                        UnaryFunction &&action) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                 std::declval<A>()))) -> void {
+    if (input.has_value()) {
+        detail::invoke(std::forward<UnaryFunction>(action), *std::move(input));
+    } else if constexpr (detail::is_instrumented_v<std::decay_t<UnaryFunction>>) {
+        action.record_short_circuit();
     }
 }
 
@@ -0,0 +1,90 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_FUSE_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_FUSE_H
+
+#include "absent/adapters/either/either.h"
+#include "absent/fuse.h"
+#include "absent/support/allocator.h"
+
+#include <utility>
+
+namespace rvarago::absent::detail {
+
+template <typename A, typename E>
+struct fusion<adapters::types::either<A, E>> final {
+    template <typename B>
+    using rebind = adapters::types::either<B, E>;
+
+    static constexpr auto has_value(adapters::types::either<A, E> const &n) noexcept -> bool {
+        return n.has_value();
+    }
+
+    static constexpr auto value(adapters::types::either<A, E> const &n) noexcept -> A const & {
+        return *n;
+    }
+
+    static constexpr auto value(adapters::types::either<A, E> &&n) noexcept -> A && {
+        return *std::move(n);
+    }
+
+    template <typename Result>
+    static constexpr auto propagate(adapters::types::either<A, E> const &n) -> Result {
+        return Result{adapters::types::in_place_error, copy_with_allocator(n.error())};
+    }
+
+    template <typename Result>
+    static constexpr auto propagate(adapters::types::either<A, E> &&n) -> Result {
+        return Result{adapters::types::in_place_error, std::move(n).error()};
+    }
+};
+
+}
+
+namespace rvarago::absent::adapters::either {
+
+using absent::fuse;
+
+/***
+ * Given an either<A, E> where E is a type that represents an error, and a deferred pipeline whose stages map A into B:
+ * - When in error: it should return a new either<B, E> in error wrapping the error value without evaluating any stage.
+ * - When *not* in error: it should feed the input value through all stages, stopping at the first one that returns an
+ * either in error, and return the final value wrapped in an either<B, E>.
+ *
+ * No intermediate either is materialised between transform stages, and each and_then stage is checked only once.
+ *
+ * @param input an either<A, E>.
+ * @param pipeline a deferred pipeline built from fuse().
+ * @return a new either containing the value produced by the pipeline, possibly in error if any stage was also in error.
+ */
+template <typename A, typename E, typename Previous, typename Stage>
+constexpr auto run(types::either<A, E> const &input, fused<Previous, Stage> const &pipeline) {
+    return detail::run(input, pipeline);
+}
+
+/***
+ * Overload of run for an rvalue either<A, E>, whose wrapped value of type A is moved into the first stage, or whose
+ * error of type E is moved into the new either<B, E>.
+ */
+template <typename A, typename E, typename Previous, typename Stage>
+constexpr auto run(types::either<A, E> &&input, fused<Previous, Stage> const &pipeline) {
+    return detail::run(std::move(input), pipeline);
+}
+
+/***
+ * Infix version of run.
+ */
+template <typename A, typename E, typename Previous, typename Stage>
+constexpr auto operator|(types::either<A, E> const &input, fused<Previous, Stage> const &pipeline) {
+    return detail::run(input, pipeline);
+}
+
+/***
+ * Infix version of run for an rvalue either<A, E>.
+ */
+template <typename A, typename E, typename Previous, typename Stage>
+constexpr auto operator|(types::either<A, E> &&input, fused<Previous, Stage> const &pipeline) {
+    return detail::run(std::move(input), pipeline);
+}
+
+}
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_LIFT_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_LIFT_H
+
+#include "absent/adapters/either/fuse.h"
+#include "absent/lift.h"
+
+namespace rvarago::absent::adapters::either {
+
+/***
+ * Given a function f: (A1, ..., An) -> B, it returns a new function that, given the eithers either<A1, E>, ...,
+ * either<An, E>, where E is a type that represents an error:
+ * - When any of them is in error: it should return a new either<B, E> in error wrapping the error value of the first
+ * input in error.
+ * - When none of them is in error: it should return a new either<B, E> wrapping the result of f called with their
+ * values.
+ */
+using absent::lift;
+
+}
+
+#endif
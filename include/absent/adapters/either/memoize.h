@@ -0,0 +1,20 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_MEMOIZE_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_MEMOIZE_H
+
+#include "absent/adapters/either/either.h"
+#include "absent/memoize.h"
+
+namespace rvarago::absent::adapters::either {
+
+/***
+ * Given an unary function f: Key -> either<B, E>, where E is a type that represents an error, it returns a new function
+ * Key -> either<B, E> that caches the results of f by key, including the ones in error unless configured otherwise,
+ * such that it may be passed to and_then.
+ */
+using absent::memoize;
+using absent::memoize_options;
+using absent::memoize_statistics;
+
+}
+
+#endif
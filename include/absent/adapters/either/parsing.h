@@ -0,0 +1,97 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_PARSING_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_PARSING_H
+
+#include "absent/adapters/either/either.h"
+#include "absent/parsing.h"
+
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::adapters::either::parsing {
+
+using absent::parsing::error;
+
+namespace detail {
+
+/***
+ * How the parsers wrap their results into either<T, error>, which keeps the reason of a failure.
+ */
+struct either_outcome final {
+    template <typename T>
+    using type = types::either<T, error>;
+
+    template <typename T>
+    static constexpr auto success(T value) noexcept -> types::either<T, error> {
+        return types::either<T, error>{types::in_place_value, std::move(value)};
+    }
+
+    template <typename T>
+    static constexpr auto failure(error reason) noexcept -> types::either<T, error> {
+        return types::either<T, error>{types::in_place_error, reason};
+    }
+};
+
+}
+
+/***
+ * Same as absent::parsing::integer, but the parser returns an either<T, error> that is in error with the reason of the
+ * failure: invalid_number, out_of_range, or trailing_characters.
+ */
+template <typename T>
+constexpr auto integer(int base = 10) noexcept {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "T must be an integral type other than bool");
+    return [base](std::string_view text) noexcept {
+        return absent::parsing::detail::parse_integer<detail::either_outcome, T>(text, base);
+    };
+}
+
+/***
+ * Same as absent::parsing::floating, but the parser returns an either<T, error> that is in error with the reason of the
+ * failure: invalid_number, out_of_range, or trailing_characters.
+ */
+template <typename T>
+constexpr auto floating(std::chars_format format = std::chars_format::general) noexcept {
+    static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+    return [format](std::string_view text) noexcept {
+        return absent::parsing::detail::parse_floating<detail::either_outcome, T>(text, format);
+    };
+}
+
+/***
+ * Same as absent::parsing::field, but the parser returns an either<string_view, error> that is in error with
+ * missing_field when the text has fewer fields.
+ */
+constexpr auto field(std::size_t index, char delimiter = ',') noexcept {
+    return [index, delimiter](std::string_view text) noexcept {
+        return absent::parsing::detail::parse_field<detail::either_outcome>(text, index, delimiter);
+    };
+}
+
+/***
+ * Same as absent::parsing::fields, but the parser returns an either<array<string_view, N>, error> that is in error with
+ * missing_field when the text has fewer than N fields, or with trailing_characters when it has more.
+ */
+template <std::size_t N>
+constexpr auto fields(char delimiter = ',') noexcept {
+    static_assert(N > 0, "There must be at least one field");
+    return [delimiter](std::string_view text) noexcept {
+        return absent::parsing::detail::parse_fields<detail::either_outcome, N>(text, delimiter);
+    };
+}
+
+/***
+ * Same as absent::parsing::key_value, but the parser returns an either<pair<string_view, string_view>, error> that is
+ * in error with missing_separator when the text doesn't have the separator.
+ */
+constexpr auto key_value(char separator = '=') noexcept {
+    return [separator](std::string_view text) noexcept {
+        return absent::parsing::detail::parse_key_value<detail::either_outcome>(text, separator);
+    };
+}
+
+}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_RANGES_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_RANGES_H
+
+#include "absent/adapters/either/either.h"
+#include "absent/adapters/either/fuse.h"
+#include "absent/ranges.h"
+
+#include <utility>
+
+namespace rvarago::absent::detail {
+
+struct is_error final {
+    template <typename A, typename E>
+    constexpr auto operator()(adapters::types::either<A, E> const &e) const noexcept -> bool {
+        return !e.has_value();
+    }
+};
+
+struct error_of final {
+    template <typename Either>
+    constexpr auto operator()(Either &&e) const noexcept -> decltype(std::forward<Either>(e).error()) {
+        return std::forward<Either>(e).error();
+    }
+};
+
+}
+
+namespace rvarago::absent::adapters::either::views {
+
+using absent::views::and_then_each;
+using absent::views::present;
+using absent::views::transform_present;
+
+/***
+ * Given a range of either<A, E> where E is a type that represents an error, it returns a lazy view of the errors of
+ * type E of the ones in error, skipping the others, e.g. to report them after processing the values with present().
+ *
+ * Nothing is copied nor allocated: the view refers to the errors inside the range, which must outlive it unless it's
+ * an rvalue.
+ *
+ * @return an adaptor that given a range of either<A, E>, returns a view of Es.
+ */
+constexpr auto errors() noexcept {
+    return absent::detail::select<absent::detail::is_error, absent::detail::error_of>(absent::detail::identity{});
+}
+
+}
+
+#endif
@@ -2,8 +2,11 @@
 #define RVARAGO_ABSENT_ADAPTERS_EITHER_TRANSFORM_H
 
 #include "absent/adapters/either/either.h"
+#include "absent/support/allocator.h"
+#include "absent/support/instrumented.h"
+#include "absent/support/invoke.h"
 
-#include <functional>
+#include <type_traits>
 #include <utility>
 
 namespace rvarago::absent::adapters::either {
@@ -20,14 +23,38 @@ namespace rvarago::absent::adapters::either {
  */
 template <typename A, typename E, typename UnaryFunction>
 constexpr auto transform(types::either<A, E> const &input,
-                         UnaryFunction &&mapper) noexcept(noexcept(std::invoke(std::forward<UnaryFunction>(mapper),
-                                                                               std::declval<A>())))
-    -> types::either<decltype(std::invoke(std::declval<UnaryFunction>(), std::declval<A>())), E> {
-    using B = decltype(std::invoke(mapper, std::declval<A>()));
-    if (auto const p = std::get_if<A>(&input); p) {
-        return types::either<B, E>{std::invoke(std::forward<UnaryFunction>(mapper), *p)};
+                         UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::forward<UnaryFunction>(mapper),
+                                                                                  std::declval<A>())))
+    -> types::either<decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())), E> {
+    using B = decltype(detail::invoke(mapper, std::declval<A>()));
+    if (input.has_value()) {
+        return types::either<B, E>{types::in_place_value, detail::invoke(std::forward<UnaryFunction>(mapper), *input)};
     } else {
-        return types::either<B, E>{std::get<E>(input)};
+        if constexpr (detail::is_instrumented_v<std::decay_t<UnaryFunction>>) {
+            mapper.record_short_circuit();
+        }
+        return types::either<B, E>{types::in_place_error, detail::copy_with_allocator(input.error())};
+    }
+}
+
+/***
+ * Overload of transform for an rvalue either<A, E>, whose wrapped value of type A is moved into the mapping function,
+ * or whose error of type E is moved into the new either<B, E>.
+ */
+template <typename A, typename E, typename UnaryFunction>
+constexpr auto transform(types::either<A, E> &&input,
+                         UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::forward<UnaryFunction>(mapper),
+                                                                                  std::declval<A>())))
+    -> types::either<decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())), E> {
+    using B = decltype(detail::invoke(mapper, std::declval<A>()));
+    if (input.has_value()) {
+        return types::either<B, E>{types::in_place_value,
+                                   detail::invoke(std::forward<UnaryFunction>(mapper), *std::move(input))};
+    } else {
+        if constexpr (detail::is_instrumented_v<std::decay_t<UnaryFunction>>) {
+            mapper.record_short_circuit();
+        }
+        return types::either<B, E>{types::in_place_error, std::move(input).error()};
     }
 }
 
@@ -36,12 +63,23 @@ constexpr auto transform(types::either<A, E> const &input,
  */
 template <typename A, typename E, typename UnaryFunction>
 constexpr auto operator|(types::either<A, E> const &input,
-                         UnaryFunction &&mapper) noexcept(noexcept(std::invoke(std::forward<UnaryFunction>(mapper),
-                                                                               std::declval<A>())))
-    -> types::either<decltype(std::invoke(std::declval<UnaryFunction>(), std::declval<A>())), E> {
+                         UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::forward<UnaryFunction>(mapper),
+                                                                                  std::declval<A>())))
+    -> types::either<decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())), E> {
     return transform(input, std::forward<UnaryFunction>(mapper));
 }
 
+/***
+ * Infix version of transform for an rvalue either<A, E>.
+ */
+template <typename A, typename E, typename UnaryFunction>
+constexpr auto operator|(types::either<A, E> &&input,
+                         UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::forward<UnaryFunction>(mapper),
+                                                                                  std::declval<A>())))
+    -> types::either<decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())), E> {
+    return transform(std::move(input), std::forward<UnaryFunction>(mapper));
+}
+
 }
 
 #endif
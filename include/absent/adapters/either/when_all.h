@@ -0,0 +1,22 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_WHENALL_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_WHENALL_H
+
+#include "absent/adapters/either/fuse.h"
+#include "absent/when_all.h"
+
+namespace rvarago::absent::adapters::either {
+
+/***
+ * Given an executor and the nullary functions f1: void -> either<A1, E>, ..., fn: void -> either<An, E>, it schedules
+ * all of them on the executor concurrently:
+ * - When any of them returns an either in error: it should satisfy the returned future with a new
+ * either<tuple<A1, ..., An>, E> in error wrapping the error value as soon as that happens, and cancel the remaining
+ * functions.
+ * - When none of them returns an either in error: it should satisfy the returned future with a new
+ * either<tuple<A1, ..., An>, E> wrapping the tuple of their values.
+ */
+using absent::when_all;
+
+}
+
+#endif
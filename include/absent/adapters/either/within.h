@@ -0,0 +1,89 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_WITHIN_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_WITHIN_H
+
+#include "absent/adapters/either/either.h"
+#include "absent/support/deadline.h"
+#include "absent/within.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::adapters::either {
+
+/***
+ * Given a deadline, and an unary function f: A -> either<B, E> (or (A, deadline) -> either<B, E> to receive the
+ * remaining budget), where E is a type that represents an error and that may be constructed from
+ * support::deadline_exceeded, e.g. std::variant<error, deadline_exceeded>, it returns a new function A -> either<B, E>
+ * for and_then that:
+ * - When the deadline has expired: it should return a new either<B, E> in error wrapping deadline_exceeded without
+ * calling f, hence a timeout may be told apart from the errors of f.
+ * - When the deadline has *not* expired: it should return the result of f.
+ *
+ * The deadline is captured by reference, and must outlive the returned function.
+ *
+ * @param deadline a support::basic_deadline<Clock>, which is checked before each call to f.
+ * @param mapper an unary function A -> either<B, E>, or a binary function (A, basic_deadline<Clock> const&) ->
+ * either<B, E>.
+ * @return a new function A -> either<B, E> that fails with deadline_exceeded once deadline has expired.
+ */
+template <typename Clock, typename UnaryFunction>
+auto within(support::basic_deadline<Clock> const &deadline, UnaryFunction &&mapper) {
+    return [&deadline, mapper = std::forward<UnaryFunction>(mapper)](auto &&value) {
+        using EitherB = std::decay_t<decltype(absent::detail::invoke_within(
+            mapper, std::forward<decltype(value)>(value), deadline))>;
+        static_assert(std::is_constructible_v<typename EitherB::error_type, support::deadline_exceeded>,
+                      "The error type must be constructible from support::deadline_exceeded");
+        if (deadline.expired()) {
+            return EitherB{types::in_place_error, support::deadline_exceeded{}};
+        }
+        return EitherB{absent::detail::invoke_within(mapper, std::forward<decltype(value)>(value), deadline)};
+    };
+}
+
+/***
+ * Given a deadline, and an unary function f: A -> B (or (A, deadline) -> B to receive the remaining budget), it returns
+ * a new function A -> either<B, E> for and_then that:
+ * - When the deadline has expired: it should return a new either<B, E> in error wrapping deadline_exceeded without
+ * calling f.
+ * - When the deadline has *not* expired: it should return an either<B, E> holding the result of f.
+ *
+ * Hence, it's within for the stages of transform, whose result can't fail by itself, e.g.
+ * input >> transform_within<error>(deadline, to_upper). The deadline is captured by reference, and must outlive the
+ * returned function.
+ *
+ * @param deadline a support::basic_deadline<Clock>, which is checked before each call to f.
+ * @param mapper an unary function A -> B, or a binary function (A, basic_deadline<Clock> const&) -> B.
+ * @return a new function A -> either<B, E> that fails with deadline_exceeded once deadline has expired.
+ */
+template <typename E, typename Clock, typename UnaryFunction>
+auto transform_within(support::basic_deadline<Clock> const &deadline, UnaryFunction &&mapper) {
+    static_assert(std::is_constructible_v<E, support::deadline_exceeded>,
+                  "The error type must be constructible from support::deadline_exceeded");
+    return [&deadline, mapper = std::forward<UnaryFunction>(mapper)](auto &&value) {
+        using EitherB = types::either<std::decay_t<decltype(absent::detail::invoke_within(
+                                          mapper, std::forward<decltype(value)>(value), deadline))>,
+                                      E>;
+        if (deadline.expired()) {
+            return EitherB{types::in_place_error, support::deadline_exceeded{}};
+        }
+        return EitherB{types::in_place_value,
+                       absent::detail::invoke_within(mapper, std::forward<decltype(value)>(value), deadline)};
+    };
+}
+
+/***
+ * Overload of within for a temporary deadline, e.g. within(deadline::after(budget), f), which is deleted since the
+ * returned function would keep a dangling reference to it.
+ */
+template <typename Clock, typename UnaryFunction>
+auto within(support::basic_deadline<Clock> const &&deadline, UnaryFunction &&mapper) = delete;
+
+/***
+ * Overload of transform_within for a temporary deadline, which is deleted for the same reason.
+ */
+template <typename E, typename Clock, typename UnaryFunction>
+auto transform_within(support::basic_deadline<Clock> const &&deadline, UnaryFunction &&mapper) = delete;
+
+}
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_EITHER_ZIP_H
+#define RVARAGO_ABSENT_ADAPTERS_EITHER_ZIP_H
+
+#include "absent/adapters/either/fuse.h"
+#include "absent/zip.h"
+
+namespace rvarago::absent::adapters::either {
+
+/***
+ * Given the eithers either<A1, E>, ..., either<An, E>, where E is a type that represents an error:
+ * - When any of them is in error: it should return a new either<tuple<A1, ..., An>, E> in error wrapping the error
+ * value of the first input in error.
+ * - When none of them is in error: it should return a new either<tuple<A1, ..., An>, E> wrapping the tuple of their
+ * values.
+ */
+using absent::zip;
+
+}
+
+#endif
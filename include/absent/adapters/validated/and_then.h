@@ -0,0 +1,72 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_VALIDATED_ANDTHEN_H
+#define RVARAGO_ABSENT_ADAPTERS_VALIDATED_ANDTHEN_H
+
+#include "absent/adapters/validated/validated.h"
+#include "absent/support/invoke.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::adapters::validated {
+
+/***
+ * Given a validated<A, E, N> where E is a type that represents an error, and an unary function f: A ->
+ * validated<B, E, N>:
+ * - When holding errors: it should return a new validated<B, E, N> holding the same errors.
+ * - When holding a value: it should return the validated<B, E, N> generated by applying the unary mapping function to
+ * the input value of type A.
+ *
+ * Since f depends on the value, and_then can't accumulate errors, and it stops at the first input holding errors, as
+ * for either<A, E>. Independent checks should rather be combined with zip or lift.
+ *
+ * @param input a validated<A, E, N>.
+ * @param mapper an unary function A -> validated<B, E, N>.
+ * @return a new validated containing the mapped value of type B, possibly holding errors if input was also holding
+ * errors.
+ */
+template <typename A, typename E, std::size_t N, typename UnaryFunction>
+auto and_then(types::validated<A, E, N> const &input, UnaryFunction &&mapper)
+    -> decltype(absent::detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
+    using ValidatedB = decltype(absent::detail::invoke(mapper, std::declval<A>()));
+    if (input.has_value()) {
+        return absent::detail::invoke(std::forward<UnaryFunction>(mapper), *input);
+    }
+    return ValidatedB{input.errors()};
+}
+
+/***
+ * Overload of and_then for an rvalue validated<A, E, N>, whose wrapped value of type A is moved into the mapping
+ * function, or whose errors are moved into the new validated<B, E, N>.
+ */
+template <typename A, typename E, std::size_t N, typename UnaryFunction>
+auto and_then(types::validated<A, E, N> &&input, UnaryFunction &&mapper)
+    -> decltype(absent::detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
+    using ValidatedB = decltype(absent::detail::invoke(mapper, std::declval<A>()));
+    if (input.has_value()) {
+        return absent::detail::invoke(std::forward<UnaryFunction>(mapper), *std::move(input));
+    }
+    return ValidatedB{std::move(input).errors()};
+}
+
+/***
+ * Infix version of and_then.
+ */
+template <typename A, typename E, std::size_t N, typename UnaryFunction>
+auto operator>>(types::validated<A, E, N> const &input, UnaryFunction &&mapper)
+    -> decltype(absent::detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
+    return and_then(input, std::forward<UnaryFunction>(mapper));
+}
+
+/***
+ * Infix version of and_then for an rvalue validated<A, E, N>.
+ */
+template <typename A, typename E, std::size_t N, typename UnaryFunction>
+auto operator>>(types::validated<A, E, N> &&input, UnaryFunction &&mapper)
+    -> decltype(absent::detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
+    return and_then(std::move(input), std::forward<UnaryFunction>(mapper));
+}
+
+}
+
+#endif
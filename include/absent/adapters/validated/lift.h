@@ -0,0 +1,46 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_VALIDATED_LIFT_H
+#define RVARAGO_ABSENT_ADAPTERS_VALIDATED_LIFT_H
+
+#include "absent/adapters/validated/zip.h"
+#include "absent/support/invoke.h"
+
+#include <utility>
+
+namespace rvarago::absent::adapters::validated {
+
+/***
+ * Given a function f: (A1, ..., An) -> B, it returns a new function that, given the validated types
+ * validated<A1, E, N>, ..., validated<An, E, N>, where E is a type that represents an error, and that result from
+ * independent checks:
+ * - When any of them holds errors: it should return a new validated<B, E, N> holding the errors of all the inputs
+ * holding errors, in order.
+ * - When none of them holds errors: it should return a new validated<B, E, N> wrapping the result of f called with
+ * their values.
+ *
+ * f receives references to the values wrapped inside the inputs, which are rvalue references for rvalue inputs, hence
+ * nothing is copied. Unlike adapters::either::lift, it doesn't stop at the first input holding errors.
+ *
+ * @param mapper a function (A1, ..., An) -> B.
+ * @return a new function (validated<A1, E, N>, ..., validated<An, E, N>) -> validated<B, E, N>.
+ */
+template <typename Function>
+auto lift(Function &&mapper) {
+    return [mapper = std::forward<Function>(mapper)](auto &&input, auto &&... inputs) {
+        static_assert(detail::are_compatible_v<decltype(input), decltype(inputs)...>,
+                      "All the inputs must be validated with the same error type and inline capacity");
+        using B = decltype(absent::detail::invoke(mapper, *std::forward<decltype(input)>(input),
+                                                  *std::forward<decltype(inputs)>(inputs)...));
+        using Result = typename detail::traits_of<decltype(input)>::template rebind<B>;
+        if (!detail::all_have_value(input, inputs...)) {
+            return Result{detail::accumulate_errors<typename detail::traits_of<decltype(input)>::errors_type>(
+                std::forward<decltype(input)>(input), std::forward<decltype(inputs)>(inputs)...)};
+        }
+        return Result{types::in_place_value,
+                      absent::detail::invoke(mapper, *std::forward<decltype(input)>(input),
+                                             *std::forward<decltype(inputs)>(inputs)...)};
+    };
+}
+
+}
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_VALIDATED_TRANSFORM_H
+#define RVARAGO_ABSENT_ADAPTERS_VALIDATED_TRANSFORM_H
+
+#include "absent/adapters/validated/validated.h"
+#include "absent/support/invoke.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::adapters::validated {
+
+/***
+ * Given a validated<A, E, N> where E is a type that represents an error, and an unary function f: A -> B:
+ * - When holding errors: it should return a new validated<B, E, N> holding the same errors.
+ * - When holding a value: it should return a new validated<B, E, N> wrapping the result of calling f with the input
+ * value of type A.
+ *
+ * @param input a validated<A, E, N>.
+ * @param mapper an unary function A -> B.
+ * @return a new validated containing the mapped value of type B, possibly holding errors if input was also holding
+ * errors.
+ */
+template <typename A, typename E, std::size_t N, typename UnaryFunction>
+auto transform(types::validated<A, E, N> const &input, UnaryFunction &&mapper)
+    -> types::validated<decltype(absent::detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())), E, N> {
+    using B = decltype(absent::detail::invoke(mapper, std::declval<A>()));
+    if (input.has_value()) {
+        return types::validated<B, E, N>{types::in_place_value,
+                                         absent::detail::invoke(std::forward<UnaryFunction>(mapper), *input)};
+    }
+    return types::validated<B, E, N>{input.errors()};
+}
+
+/***
+ * Overload of transform for an rvalue validated<A, E, N>, whose wrapped value of type A is moved into the mapping
+ * function, or whose errors are moved into the new validated<B, E, N>.
+ */
+template <typename A, typename E, std::size_t N, typename UnaryFunction>
+auto transform(types::validated<A, E, N> &&input, UnaryFunction &&mapper)
+    -> types::validated<decltype(absent::detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())), E, N> {
+    using B = decltype(absent::detail::invoke(mapper, std::declval<A>()));
+    if (input.has_value()) {
+        return types::validated<B, E, N>{
+            types::in_place_value, absent::detail::invoke(std::forward<UnaryFunction>(mapper), *std::move(input))};
+    }
+    return types::validated<B, E, N>{std::move(input).errors()};
+}
+
+/***
+ * Infix version of transform.
+ */
+template <typename A, typename E, std::size_t N, typename UnaryFunction>
+auto operator|(types::validated<A, E, N> const &input, UnaryFunction &&mapper)
+    -> types::validated<decltype(absent::detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())), E, N> {
+    return transform(input, std::forward<UnaryFunction>(mapper));
+}
+
+/***
+ * Infix version of transform for an rvalue validated<A, E, N>.
+ */
+template <typename A, typename E, std::size_t N, typename UnaryFunction>
+auto operator|(types::validated<A, E, N> &&input, UnaryFunction &&mapper)
+    -> types::validated<decltype(absent::detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())), E, N> {
+    return transform(std::move(input), std::forward<UnaryFunction>(mapper));
+}
+
+}
+
+#endif
@@ -0,0 +1,176 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_VALIDATED_H
+#define RVARAGO_ABSENT_ADAPTERS_VALIDATED_H
+
+#include "absent/adapters/either/either.h"
+#include "absent/support/small_vector.h"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::adapters::types {
+
+/**
+ * Holds either a value of type A or, by convention, one or more errors of type E, which are accumulated by the
+ * combinators of adapters::validated across independent checks, rather than stopping at the first one as either<A, E>
+ * does.
+ *
+ * The errors are stored in a support::small_vector<E, N>, hence up to N of them are stored inline, and holding a value
+ * never allocates.
+ */
+template <typename A, typename E, std::size_t N = 4>
+class validated final {
+  public:
+    using value_type = A;
+    using error_type = E;
+    using errors_type = support::small_vector<E, N>;
+
+  private:
+    either<A, errors_type> _either;
+
+    template <typename U>
+    static constexpr bool is_validated_or_tag_v =
+        std::is_same_v<detail::remove_cvref_t<U>, validated> ||
+        std::is_same_v<detail::remove_cvref_t<U>, errors_type> ||
+        std::is_same_v<detail::remove_cvref_t<U>, in_place_value_t> ||
+        std::is_same_v<detail::remove_cvref_t<U>, in_place_error_t>;
+
+  public:
+    /**
+     * Creates a validated holding a value-initialized A.
+     */
+    template <typename U = A, std::enable_if_t<std::is_default_constructible_v<U>, int> = 0>
+    constexpr validated() noexcept(std::is_nothrow_default_constructible_v<A>) : _either{in_place_value} {
+    }
+
+    /**
+     * Creates a validated holding a value of type A converted from value, when it's unambiguously an A.
+     */
+    template <typename U,
+              std::enable_if_t<!std::is_same_v<A, E> && !is_validated_or_tag_v<U> && std::is_convertible_v<U &&, A> &&
+                                   !std::is_same_v<detail::remove_cvref_t<U>, E>,
+                               int> = 0>
+    constexpr validated(U &&value) noexcept(std::is_nothrow_constructible_v<A, U &&>)
+        : _either{in_place_value, std::forward<U>(value)} {
+    }
+
+    /**
+     * Creates a validated holding a single error of type E converted from error, when it's unambiguously an E.
+     */
+    template <typename U,
+              std::enable_if_t<!std::is_same_v<A, E> && !is_validated_or_tag_v<U> && std::is_convertible_v<U &&, E> &&
+                                   (std::is_same_v<detail::remove_cvref_t<U>, E> || !std::is_convertible_v<U &&, A>),
+                               int> = 0>
+    validated(U &&error) : validated{in_place_error, std::forward<U>(error)} {
+    }
+
+    template <typename... Args>
+    constexpr explicit validated(in_place_value_t, Args &&... args) noexcept(
+        std::is_nothrow_constructible_v<A, Args &&...>)
+        : _either{in_place_value, std::forward<Args>(args)...} {
+    }
+
+    /**
+     * Creates a validated holding a single error of type E constructed in-place from args.
+     */
+    template <typename... Args>
+    explicit validated(in_place_error_t, Args &&... args) : _either{in_place_error} {
+        _either.error().emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Creates a validated holding the errors, which must not be empty.
+     */
+    explicit validated(errors_type errors) noexcept(std::is_nothrow_move_constructible_v<E>)
+        : _either{in_place_error, std::move(errors)} {
+    }
+
+    /**
+     * @return whether it holds a value of type A rather than errors of type E.
+     */
+    constexpr auto has_value() const noexcept -> bool {
+        return _either.has_value();
+    }
+
+    /**
+     * Unchecked access to the value of type A, which must be held.
+     */
+    constexpr auto operator*() const &noexcept -> A const & {
+        return *_either;
+    }
+
+    constexpr auto operator*() &noexcept -> A & {
+        return *_either;
+    }
+
+    constexpr auto operator*() &&noexcept -> A && {
+        return *std::move(_either);
+    }
+
+    constexpr auto operator->() const noexcept -> A const * {
+        return std::addressof(*_either);
+    }
+
+    constexpr auto operator->() noexcept -> A * {
+        return std::addressof(*_either);
+    }
+
+    /**
+     * Unchecked access to the errors of type E, in the order they were found, which must be held.
+     */
+    constexpr auto errors() const &noexcept -> errors_type const & {
+        return _either.error();
+    }
+
+    constexpr auto errors() &noexcept -> errors_type & {
+        return _either.error();
+    }
+
+    constexpr auto errors() &&noexcept -> errors_type && {
+        return std::move(_either).error();
+    }
+
+    friend auto operator==(validated const &lhs, validated const &rhs) -> bool {
+        return lhs._either == rhs._either;
+    }
+
+    friend auto operator!=(validated const &lhs, validated const &rhs) -> bool {
+        return !(lhs == rhs);
+    }
+};
+
+}
+
+namespace rvarago::absent::adapters::validated {
+
+/***
+ * Given an either<A, E>, it returns a new validated<A, E, N> holding either its value or its error, such that checks
+ * returning an either<A, E>, e.g. the parsers of adapters::either::parsing, may be combined by accumulating their
+ * errors.
+ *
+ * @param input an either<A, E>.
+ * @return a new validated<A, E, N> holding either the value or the error of input.
+ */
+template <std::size_t N = 4, typename A, typename E>
+auto from_either(types::either<A, E> const &input) -> types::validated<A, E, N> {
+    if (input.has_value()) {
+        return types::validated<A, E, N>{types::in_place_value, *input};
+    }
+    return types::validated<A, E, N>{types::in_place_error, input.error()};
+}
+
+/***
+ * Overload of from_either for an rvalue either<A, E>, whose value or error is moved into the new validated<A, E, N>.
+ */
+template <std::size_t N = 4, typename A, typename E>
+auto from_either(types::either<A, E> &&input) -> types::validated<A, E, N> {
+    if (input.has_value()) {
+        return types::validated<A, E, N>{types::in_place_value, *std::move(input)};
+    }
+    return types::validated<A, E, N>{types::in_place_error, std::move(input).error()};
+}
+
+}
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef RVARAGO_ABSENT_ADAPTERS_VALIDATED_ZIP_H
+#define RVARAGO_ABSENT_ADAPTERS_VALIDATED_ZIP_H
+
+#include "absent/adapters/validated/validated.h"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::adapters::validated {
+
+namespace detail {
+
+template <typename T>
+struct validated_traits final {
+    static constexpr bool is_validated = false;
+
+    using errors_type = void;
+};
+
+template <typename A, typename E, std::size_t N>
+struct validated_traits<types::validated<A, E, N>> final {
+    static constexpr bool is_validated = true;
+
+    using errors_type = typename types::validated<A, E, N>::errors_type;
+
+    template <typename B>
+    using rebind = types::validated<B, E, N>;
+};
+
+template <typename V>
+using traits_of = validated_traits<std::remove_cv_t<std::remove_reference_t<V>>>;
+
+template <typename V>
+using value_of_t = std::decay_t<decltype(*std::declval<V>())>;
+
+template <typename V, typename W>
+inline constexpr bool is_compatible_with_v =
+    traits_of<W>::is_validated &&
+    std::is_same_v<typename traits_of<W>::errors_type, typename traits_of<V>::errors_type>;
+
+/***
+ * Whether the types V and Vs are all validated<Ai, E, N> with the same E and N, i.e. whose errors may be accumulated
+ * together.
+ */
+template <typename V, typename... Vs>
+inline constexpr bool are_compatible_v =
+    traits_of<V>::is_validated && (is_compatible_with_v<V, Vs> && ...);
+
+template <typename... Validateds>
+constexpr auto all_have_value(Validateds const &... inputs) noexcept -> bool {
+    return (static_cast<unsigned>(inputs.has_value()) & ...) != 0;
+}
+
+template <typename Errors, typename Validated>
+auto append_errors(Errors &errors, Validated &&input) -> void {
+    if (input.has_value()) {
+        return;
+    }
+    for (auto &&error : std::forward<Validated>(input).errors()) {
+        if constexpr (std::is_lvalue_reference_v<Validated>) {
+            errors.emplace_back(error);
+        } else {
+            errors.emplace_back(std::move(error));
+        }
+    }
+}
+
+/***
+ * Accumulates the errors of all the inputs, in order, reserving room for all of them at once, such that it allocates
+ * at most once when there are more than N of them, and never otherwise.
+ */
+template <typename Errors, typename... Validateds>
+auto accumulate_errors(Validateds &&... inputs) -> Errors {
+    auto errors = Errors{};
+    errors.reserve((std::size_t{0} + ... + (inputs.has_value() ? 0 : inputs.errors().size())));
+    (append_errors(errors, std::forward<Validateds>(inputs)), ...);
+    return errors;
+}
+
+}
+
+/***
+ * Given the validated types validated<A1, E, N>, ..., validated<An, E, N>, where E is a type that represents an error,
+ * and that result from independent checks:
+ * - When any of them holds errors: it should return a new validated<tuple<A1, ..., An>, E, N> holding the errors of all
+ * the inputs holding errors, in order.
+ * - When none of them holds errors: it should return a new validated<tuple<A1, ..., An>, E, N> wrapping the tuple of
+ * their values, which are moved out of rvalue inputs.
+ *
+ * Unlike adapters::either::zip, it doesn't stop at the first input holding errors.
+ *
+ * @param inputs validated<Ai, E, N> with the same E and N.
+ * @return a new validated containing the tuple of values, possibly holding the errors of the inputs.
+ */
+template <typename Validated, typename... Validateds,
+          std::enable_if_t<detail::are_compatible_v<Validated, Validateds...>, int> = 0>
+auto zip(Validated &&input, Validateds &&... inputs) {
+    using Values = std::tuple<detail::value_of_t<Validated>, detail::value_of_t<Validateds>...>;
+    using Result = typename detail::traits_of<Validated>::template rebind<Values>;
+    if (!detail::all_have_value(input, inputs...)) {
+        return Result{detail::accumulate_errors<typename detail::traits_of<Validated>::errors_type>(
+            std::forward<Validated>(input), std::forward<Validateds>(inputs)...)};
+    }
+    return Result{types::in_place_value,
+                  Values{*std::forward<Validated>(input), *std::forward<Validateds>(inputs)...}};
+}
+
+}
+
+#endif
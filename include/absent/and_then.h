@@ -1,7 +1,11 @@
 #ifndef RVARAGO_ABSENT_ANDTHEN_H
 #define RVARAGO_ABSENT_ANDTHEN_H
 
-#include <functional>
+#include "absent/support/instrumented.h"
+#include "absent/support/invoke.h"
+#include "absent/support/non_owning.h"
+
+#include <type_traits>
 #include <utility>
 
 namespace rvarago::absent {
@@ -18,14 +22,37 @@ namespace rvarago::absent {
  */
 template <template <typename> typename Nullable, typename UnaryFunction, typename A>
 constexpr auto and_then(Nullable<A> const &input,
-                        UnaryFunction &&mapper) noexcept(noexcept(std::invoke(std::declval<UnaryFunction>(),
-                                                                              std::declval<A>())))
-    -> decltype(std::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
-    using NullableB = decltype(std::invoke(mapper, std::declval<A>()));
+                        UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                 std::declval<A>())))
+    -> decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
+    using NullableB = decltype(detail::invoke(mapper, std::declval<A>()));
     if (!input) {
+        if constexpr (detail::is_instrumented_v<std::decay_t<UnaryFunction>>) {
+            mapper.record_short_circuit();
+        }
         return NullableB{};
     } else {
-        return std::invoke(std::forward<UnaryFunction>(mapper), *input);
+        return detail::invoke(std::forward<UnaryFunction>(mapper), *input);
+    }
+}
+
+/***
+ * Overload of and_then for an rvalue nullable N<A>, whose wrapped value of type A is moved into the mapping function.
+ */
+template <template <typename> typename Nullable, typename UnaryFunction, typename A,
+          std::enable_if_t<!detail::is_non_owning_v<Nullable<A>>, int> = 0>
+constexpr auto and_then(Nullable<A> &&input,
+                        UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                 std::declval<A>())))
+    -> decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
+    using NullableB = decltype(detail::invoke(mapper, std::declval<A>()));
+    if (!input) {
+        if constexpr (detail::is_instrumented_v<std::decay_t<UnaryFunction>>) {
+            mapper.record_short_circuit();
+        }
+        return NullableB{};
+    } else {
+        return detail::invoke(std::forward<UnaryFunction>(mapper), std::move(*input));
     }
 }
 
@@ -34,12 +61,24 @@ constexpr auto and_then(Nullable<A> const &input,
  */
 template <template <typename> typename Nullable, typename UnaryFunction, typename A>
 constexpr auto operator>>(Nullable<A> const &input,
-                          UnaryFunction &&mapper) noexcept(noexcept(std::invoke(std::declval<UnaryFunction>(),
-                                                                                std::declval<A>())))
-    -> decltype(std::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
+                          UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                   std::declval<A>())))
+    -> decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
     return and_then(input, std::forward<UnaryFunction>(mapper));
 }
 
+/***
+ * Infix version of and_then for an rvalue nullable N<A>.
+ */
+template <template <typename> typename Nullable, typename UnaryFunction, typename A,
+          std::enable_if_t<!detail::is_non_owning_v<Nullable<A>>, int> = 0>
+constexpr auto operator>>(Nullable<A> &&input,
+                          UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                   std::declval<A>())))
+    -> decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>())) {
+    return and_then(std::move(input), std::forward<UnaryFunction>(mapper));
+}
+
 }
 
 #endif
@@ -0,0 +1,202 @@
+#ifndef RVARAGO_ABSENT_ASYNC_H
+#define RVARAGO_ABSENT_ASYNC_H
+
+#include "absent/fuse.h"
+#include "absent/support/future.h"
+#include "absent/support/invoke.h"
+
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent {
+
+namespace detail {
+
+/***
+ * Satisfies output with the value produced by f, or with the exception thrown by it.
+ */
+template <typename T, typename NullaryFunction>
+auto satisfy(support::promise<T> const &output, NullaryFunction &&f) -> void {
+    try {
+        output.set_value(detail::invoke(std::forward<NullaryFunction>(f)));
+    } catch (...) {
+        output.set_exception(std::current_exception());
+    }
+}
+
+/***
+ * Forwards the value, or the exception, of input into output once input is ready.
+ */
+template <typename T>
+auto forward_into(support::future<T> &&input, support::promise<T> &&output) -> void {
+    std::move(input).subscribe([output = std::move(output)](support::future<T> ready) mutable {
+        satisfy(output, [&ready] { return ready.get(); });
+    });
+}
+
+/***
+ * Calls on_value with the nullable held by input once it's ready and not empty. Otherwise, it satisfies output
+ * directly, either with the propagated empty nullable or with the exception held by input, without calling on_value.
+ */
+template <typename Fusion, typename Nullable, typename Result, typename UnaryFunction>
+auto when_value(support::future<Nullable> &&input, support::promise<Result> &&output, UnaryFunction &&on_value)
+    -> void {
+    std::move(input).subscribe([output = std::move(output), on_value = std::forward<UnaryFunction>(on_value)](
+                                   support::future<Nullable> ready) mutable {
+        auto nullable = std::optional<Nullable>{};
+        try {
+            nullable.emplace(ready.get());
+        } catch (...) {
+            output.set_exception(std::current_exception());
+            return;
+        }
+        if (!Fusion::has_value(*nullable)) {
+            satisfy(output, [&nullable] { return Fusion::template propagate<Result>(std::move(*nullable)); });
+        } else {
+            on_value(std::move(output), std::move(*nullable));
+        }
+    });
+}
+
+template <typename Fusion, typename Nullable, typename Executor, typename UnaryFunction>
+auto async_transform(support::future<Nullable> &&input, Executor &executor, UnaryFunction &&mapper) {
+    using A = decltype(Fusion::value(std::declval<Nullable>()));
+    using NullableB = typename Fusion::template rebind<std::invoke_result_t<std::decay_t<UnaryFunction> &, A>>;
+
+    auto output = support::promise<NullableB>{};
+    auto result = output.get_future();
+    when_value<Fusion>(std::move(input), std::move(output),
+                       [&executor, mapper = std::forward<UnaryFunction>(mapper)](
+                           support::promise<NullableB> &&output, Nullable &&nullable) mutable {
+                           executor.execute([output = std::move(output), mapper = std::move(mapper),
+                                             nullable = std::move(nullable)]() mutable {
+                               satisfy(output, [&] {
+                                   return NullableB{detail::invoke(mapper, Fusion::value(std::move(nullable)))};
+                               });
+                           });
+                       });
+    return result;
+}
+
+template <typename Fusion, typename Nullable, typename Executor, typename UnaryFunction>
+auto async_and_then(support::future<Nullable> &&input, Executor &executor, UnaryFunction &&mapper) {
+    using A = decltype(Fusion::value(std::declval<Nullable>()));
+    using Next = std::invoke_result_t<std::decay_t<UnaryFunction> &, A>;
+    constexpr auto is_async = support::is_future_v<Next>;
+    using NullableB = typename std::conditional_t<is_async, Next, support::future<Next>>::value_type;
+
+    auto output = support::promise<NullableB>{};
+    auto result = output.get_future();
+    when_value<Fusion>(std::move(input), std::move(output),
+                       [&executor, mapper = std::forward<UnaryFunction>(mapper)](
+                           support::promise<NullableB> &&output, Nullable &&nullable) mutable {
+                           executor.execute([output = std::move(output), mapper = std::move(mapper),
+                                             nullable = std::move(nullable)]() mutable {
+                               if constexpr (is_async) {
+                                   auto next = support::future<NullableB>{};
+                                   try {
+                                       next = detail::invoke(mapper, Fusion::value(std::move(nullable)));
+                                   } catch (...) {
+                                       output.set_exception(std::current_exception());
+                                       return;
+                                   }
+                                   forward_into(std::move(next), std::move(output));
+                               } else {
+                                   satisfy(output,
+                                           [&] { return detail::invoke(mapper, Fusion::value(std::move(nullable))); });
+                               }
+                           });
+                       });
+    return result;
+}
+
+template <typename Fusion, typename Nullable, typename Executor, typename NullaryFunction>
+auto async_eval(support::future<Nullable> &&input, Executor &executor, NullaryFunction &&fallback) {
+    using A = std::decay_t<decltype(Fusion::value(std::declval<Nullable>()))>;
+
+    auto output = support::promise<A>{};
+    auto result = output.get_future();
+    std::move(input).subscribe([output = std::move(output), &executor,
+                                fallback = std::forward<NullaryFunction>(fallback)](
+                                   support::future<Nullable> ready) mutable {
+        auto nullable = std::optional<Nullable>{};
+        try {
+            nullable.emplace(ready.get());
+        } catch (...) {
+            output.set_exception(std::current_exception());
+            return;
+        }
+        if (Fusion::has_value(*nullable)) {
+            satisfy(output, [&nullable] { return Fusion::value(std::move(*nullable)); });
+        } else {
+            executor.execute([output = std::move(output), fallback = std::move(fallback)]() mutable {
+                satisfy(output, fallback);
+            });
+        }
+    });
+    return result;
+}
+
+}
+
+/***
+ * Given a future of a nullable type N<A> (i.e. optional-like object), an executor, and an unary function f: A -> B:
+ * - When the nullable is empty: it should return a future of a new empty nullable N<B> without scheduling f.
+ * - When the nullable is *not* empty: it should schedule f on the executor and return a future of a new nullable N<B>
+ * wrapping the result of f.
+ *
+ * No thread is blocked while waiting for input, and exceptions thrown by f are stored in the returned future.
+ *
+ * @param input a future of a nullable N<A>.
+ * @param executor an object whose member function execute(g) eventually invokes g, and which outlives the pipeline.
+ * @param mapper an unary function A -> B.
+ * @return a future of a new nullable containing the mapped value, possibly empty if input is also empty.
+ */
+template <template <typename> typename Nullable, typename A, typename Executor, typename UnaryFunction>
+auto transform(support::future<Nullable<A>> input, Executor &executor, UnaryFunction &&mapper) {
+    return detail::async_transform<detail::fusion<Nullable<A>>>(std::move(input), executor,
+                                                                std::forward<UnaryFunction>(mapper));
+}
+
+/***
+ * Given a future of a nullable type N<A> (i.e. optional-like object), an executor, and an unary function f that is
+ * either A -> future<N<B>> or A -> N<B>:
+ * - When the nullable is empty: it should return a future of a new empty nullable N<B> without scheduling f.
+ * - When the nullable is *not* empty: it should schedule f on the executor and return a future of the nullable N<B>
+ * eventually returned by f.
+ *
+ * No thread is blocked while waiting for input nor for the future returned by f, and exceptions thrown by f are stored
+ * in the returned future.
+ *
+ * @param input a future of a nullable N<A>.
+ * @param executor an object whose member function execute(g) eventually invokes g, and which outlives the pipeline.
+ * @param mapper an unary function A -> future<N<B>> or A -> N<B>.
+ * @return a future of the nullable returned by mapper, possibly empty if input is also empty.
+ */
+template <template <typename> typename Nullable, typename A, typename Executor, typename UnaryFunction>
+auto and_then(support::future<Nullable<A>> input, Executor &executor, UnaryFunction &&mapper) {
+    return detail::async_and_then<detail::fusion<Nullable<A>>>(std::move(input), executor,
+                                                               std::forward<UnaryFunction>(mapper));
+}
+
+/***
+ * Given a future of a nullable type N<A> (i.e. optional-like object), an executor, and a nullary function f: void -> A:
+ * - When the nullable is empty: it should schedule f on the executor and return a future of its result.
+ * - When the nullable is *not* empty: it should return a future of the wrapped value without scheduling f.
+ *
+ * @param input a future of a nullable N<A>.
+ * @param executor an object whose member function execute(g) eventually invokes g, and which outlives the pipeline.
+ * @param fallback a nullary function void -> A.
+ * @return a future of the value wrapped inside input, or of the result of fallback if input is empty.
+ */
+template <template <typename> typename Nullable, typename A, typename Executor, typename NullaryFunction>
+auto eval(support::future<Nullable<A>> input, Executor &executor, NullaryFunction &&fallback) -> support::future<A> {
+    return detail::async_eval<detail::fusion<Nullable<A>>>(std::move(input), executor,
+                                                           std::forward<NullaryFunction>(fallback));
+}
+
+}
+
+#endif
@@ -1,8 +1,9 @@
 #ifndef RVARAGO_ABSENT_ATTEMPT_H
 #define RVARAGO_ABSENT_ATTEMPT_H
 
+#include "absent/support/invoke.h"
+
 #include <exception>
-#include <functional>
 #include <optional>
 #include <utility>
 
@@ -19,10 +20,10 @@ namespace rvarago::absent {
  */
 template <typename BaseException = std::exception, template <typename> typename Nullable = std::optional,
           typename NullaryFunction>
-auto attempt(NullaryFunction &&unsafe) -> Nullable<decltype(std::invoke(std::declval<NullaryFunction>()))> {
-    using NullableA = Nullable<decltype(std::invoke(unsafe))>;
+auto attempt(NullaryFunction &&unsafe) -> Nullable<decltype(detail::invoke(std::declval<NullaryFunction>()))> {
+    using NullableA = Nullable<decltype(detail::invoke(unsafe))>;
     try {
-        return NullableA{std::invoke(std::forward<NullaryFunction>(unsafe))};
+        return NullableA{detail::invoke(std::forward<NullaryFunction>(unsafe))};
     } catch (BaseException const &) {
         return NullableA{};
     }
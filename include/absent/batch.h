@@ -0,0 +1,62 @@
+#ifndef RVARAGO_ABSENT_BATCH_H
+#define RVARAGO_ABSENT_BATCH_H
+
+#include "absent/and_then.h"
+#include "absent/transform.h"
+
+#include <algorithm>
+#include <execution>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent {
+
+namespace detail {
+template <typename ExecutionPolicy>
+using enable_if_execution_policy = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>;
+}
+
+/***
+ * Batch version of transform, which applies transform to every nullable N<A> in inputs under an execution policy,
+ * e.g. std::execution::par, and writes the resulting nullables N<B> into the preallocated outputs.
+ *
+ * Since mapper may be called concurrently when policy allows it, it must be safe to do so.
+ *
+ * @param policy an execution policy.
+ * @param inputs a range of nullables N<A>.
+ * @param outputs a range of nullables N<B> at least as large as inputs.
+ * @param mapper an unary function A -> B.
+ * @return an iterator to the element in outputs past the last one written.
+ */
+template <typename ExecutionPolicy, typename InputRange, typename OutputRange, typename UnaryFunction,
+          typename = detail::enable_if_execution_policy<ExecutionPolicy>>
+auto transform(ExecutionPolicy &&policy, InputRange const &inputs, OutputRange &outputs, UnaryFunction const &mapper)
+    -> decltype(std::begin(outputs)) {
+    return std::transform(std::forward<ExecutionPolicy>(policy), std::begin(inputs), std::end(inputs),
+                          std::begin(outputs), [&mapper](auto const &input) { return transform(input, mapper); });
+}
+
+/***
+ * Batch version of and_then, which applies and_then to every nullable N<A> in inputs under an execution policy,
+ * e.g. std::execution::par, and writes the resulting nullables N<B> into the preallocated outputs.
+ *
+ * Since mapper may be called concurrently when policy allows it, it must be safe to do so.
+ *
+ * @param policy an execution policy.
+ * @param inputs a range of nullables N<A>.
+ * @param outputs a range of nullables N<B> at least as large as inputs.
+ * @param mapper an unary function A -> N<B>.
+ * @return an iterator to the element in outputs past the last one written.
+ */
+template <typename ExecutionPolicy, typename InputRange, typename OutputRange, typename UnaryFunction,
+          typename = detail::enable_if_execution_policy<ExecutionPolicy>>
+auto and_then(ExecutionPolicy &&policy, InputRange const &inputs, OutputRange &outputs, UnaryFunction const &mapper)
+    -> decltype(std::begin(outputs)) {
+    return std::transform(std::forward<ExecutionPolicy>(policy), std::begin(inputs), std::end(inputs),
+                          std::begin(outputs), [&mapper](auto const &input) { return and_then(input, mapper); });
+}
+
+}
+
+#endif
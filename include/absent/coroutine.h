@@ -0,0 +1,223 @@
+#ifndef RVARAGO_ABSENT_COROUTINE_H
+#define RVARAGO_ABSENT_COROUTINE_H
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#endif
+
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+#define RVARAGO_ABSENT_HAS_COROUTINES
+#endif
+
+#ifdef RVARAGO_ABSENT_HAS_COROUTINES
+
+#include "absent/fuse.h"
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent {
+
+template <typename Nullable>
+class block;
+
+namespace detail {
+
+/***
+ * A per-thread cache of coroutine frames. Since a block lives only until its result is taken, frames are allocated and
+ * released at a steady pace, and the frames of the same block all have the same size, so that after the first call a
+ * frame is usually recycled rather than allocated.
+ */
+class frame_arena final {
+    static constexpr std::size_t capacity = 16;
+
+    struct frame final {
+        void *memory;
+        std::size_t size;
+    };
+
+    std::array<frame, capacity> _frames{};
+    std::size_t _count = 0;
+
+  public:
+    frame_arena() = default;
+    frame_arena(frame_arena const &) = delete;
+    auto operator=(frame_arena const &) -> frame_arena & = delete;
+
+    ~frame_arena() {
+        for (std::size_t i = 0; i < _count; ++i) {
+            ::operator delete(_frames[i].memory);
+        }
+    }
+
+    auto allocate(std::size_t size) -> void * {
+        for (std::size_t i = _count; i > 0; --i) {
+            if (_frames[i - 1].size == size) {
+                auto *const memory = _frames[i - 1].memory;
+                _frames[i - 1] = _frames[--_count];
+                return memory;
+            }
+        }
+        return ::operator new(size);
+    }
+
+    auto deallocate(void *memory, std::size_t size) noexcept -> void {
+        if (_count == capacity) {
+            ::operator delete(memory);
+        } else {
+            _frames[_count++] = frame{memory, size};
+        }
+    }
+
+    static auto local() -> frame_arena & {
+        thread_local frame_arena arena;
+        return arena;
+    }
+};
+
+/***
+ * Unwraps the nullable N awaited inside a block, or stops the block by propagating N into its result.
+ */
+template <typename Nullable, typename Promise>
+struct unwrap final {
+    using Fusion = fusion<std::remove_cv_t<std::remove_reference_t<Nullable>>>;
+
+    Nullable &&_input;
+
+    auto await_ready() const noexcept -> bool {
+        return Fusion::has_value(_input);
+    }
+
+    auto await_suspend(std::coroutine_handle<Promise> handle) -> void {
+        handle.promise().propagate(Fusion::template propagate<typename Promise::result_type>(
+            std::forward<Nullable>(_input)));
+    }
+
+    auto await_resume() -> decltype(auto) {
+        return Fusion::value(std::forward<Nullable>(_input));
+    }
+};
+
+template <typename Nullable>
+class block_promise final {
+    std::optional<Nullable> _result;
+    std::exception_ptr _exception;
+
+  public:
+    using result_type = Nullable;
+
+    static auto operator new(std::size_t size) -> void * {
+        return frame_arena::local().allocate(size);
+    }
+
+    static auto operator delete(void *memory, std::size_t size) noexcept -> void {
+        frame_arena::local().deallocate(memory, size);
+    }
+
+    auto get_return_object() noexcept -> block<Nullable> {
+        return block<Nullable>{std::coroutine_handle<block_promise>::from_promise(*this)};
+    }
+
+    auto initial_suspend() const noexcept -> std::suspend_never {
+        return {};
+    }
+
+    auto final_suspend() const noexcept -> std::suspend_always {
+        return {};
+    }
+
+    template <typename Awaited>
+    auto await_transform(Awaited &&input) noexcept -> unwrap<Awaited, block_promise> {
+        static_assert(is_same_kind_v<std::remove_cv_t<std::remove_reference_t<Awaited>>, Nullable>,
+                      "Only a nullable of the same kind as the result of the block can be awaited");
+        return unwrap<Awaited, block_promise>{std::forward<Awaited>(input)};
+    }
+
+    template <typename U>
+    auto return_value(U &&value) -> void {
+        _result.emplace(std::forward<U>(value));
+    }
+
+    auto propagate(Nullable &&empty) -> void {
+        _result.emplace(std::move(empty));
+    }
+
+    auto unhandled_exception() noexcept -> void {
+        _exception = std::current_exception();
+    }
+
+    auto result() -> Nullable && {
+        if (_exception) {
+            std::rethrow_exception(_exception);
+        }
+        return std::move(*_result);
+    }
+};
+
+}
+
+/***
+ * The result of a coroutine that evaluates to a nullable type N<B> (i.e. optional-like object), where every co_await
+ * on a nullable N<A>:
+ * - When empty: it should stop the coroutine and make it evaluate to a new empty nullable N<B>, destroying the values
+ * in scope.
+ * - When *not* empty: it should evaluate to the wrapped value of type A, which is moved out of an rvalue N<A>.
+ *
+ * The coroutine runs eagerly, hence its result is available as soon as it returns, and it's taken by converting it
+ * into N<B>, which rethrows any exception that escaped from the coroutine. Coroutine frames are recycled by a
+ * per-thread cache.
+ *
+ * @tparam Nullable the nullable type N<B> that the coroutine evaluates to.
+ */
+template <typename Nullable>
+class block final {
+    std::coroutine_handle<detail::block_promise<Nullable>> _handle;
+
+    friend class detail::block_promise<Nullable>;
+
+    explicit block(std::coroutine_handle<detail::block_promise<Nullable>> handle) noexcept : _handle{handle} {
+    }
+
+  public:
+    using promise_type = detail::block_promise<Nullable>;
+
+    block(block const &) = delete;
+    auto operator=(block const &) -> block & = delete;
+
+    block(block &&other) noexcept : _handle{std::exchange(other._handle, nullptr)} {
+    }
+
+    auto operator=(block &&other) noexcept -> block & {
+        if (this != &other) {
+            if (_handle) {
+                _handle.destroy();
+            }
+            _handle = std::exchange(other._handle, nullptr);
+        }
+        return *this;
+    }
+
+    ~block() {
+        if (_handle) {
+            _handle.destroy();
+        }
+    }
+
+    /***
+     * @return the nullable N<B> that the coroutine evaluated to.
+     */
+    operator Nullable() && {
+        return _handle.promise().result();
+    }
+};
+
+}
+
+#endif
+
+#endif
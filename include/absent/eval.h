@@ -1,7 +1,10 @@
 #ifndef RVARAGO_ABSENT_EVAL_H
 #define RVARAGO_ABSENT_EVAL_H
 
-#include <functional>
+#include "absent/support/invoke.h"
+#include "absent/support/non_owning.h"
+
+#include <type_traits>
 #include <utility>
 
 namespace rvarago::absent {
@@ -16,15 +19,29 @@ namespace rvarago::absent {
  * @return the wrapped value inside the nullable or the result of fallback if the nullable is empty.
  */
 template <template <typename> typename Nullable, typename NullaryFunction, typename A>
-constexpr auto eval(Nullable<A> const &input,
-                    NullaryFunction &&fallback) noexcept(noexcept(std::invoke(std::declval<NullaryFunction>()))) -> A {
+constexpr auto eval(Nullable<A> const &input, NullaryFunction &&fallback) noexcept(
+    noexcept(detail::invoke(std::declval<NullaryFunction>()))) -> A {
     if (!input) {
-        return std::invoke(std::forward<NullaryFunction>(fallback));
+        return detail::invoke(std::forward<NullaryFunction>(fallback));
     } else {
         return *input;
     }
 }
 
+/***
+ * Overload of eval for an rvalue nullable N<A>, whose wrapped value of type A is moved out instead of copied.
+ */
+template <template <typename> typename Nullable, typename NullaryFunction, typename A,
+          std::enable_if_t<!detail::is_non_owning_v<Nullable<A>>, int> = 0>
+constexpr auto eval(Nullable<A> &&input, NullaryFunction &&fallback) noexcept(
+    noexcept(detail::invoke(std::declval<NullaryFunction>()))) -> A {
+    if (!input) {
+        return detail::invoke(std::forward<NullaryFunction>(fallback));
+    } else {
+        return std::move(*input);
+    }
+}
+
 }
 
 #endif
@@ -0,0 +1,219 @@
+#ifndef RVARAGO_ABSENT_FIRSTOF_H
+#define RVARAGO_ABSENT_FIRSTOF_H
+
+#include "absent/fuse.h"
+#include "absent/support/cancellation.h"
+#include "absent/support/future.h"
+#include "absent/support/invoke.h"
+#include "absent/support/timer.h"
+#include "absent/when_all.h"
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent {
+
+namespace detail {
+
+template <typename Result, typename NullaryFunction>
+constexpr auto first_of_sequential(NullaryFunction &&last) -> Result {
+    return detail::invoke(std::forward<NullaryFunction>(last));
+}
+
+template <typename Result, typename NullaryFunction, typename... NullaryFunctions>
+constexpr auto first_of_sequential(NullaryFunction &&alternative, NullaryFunctions &&... rest) -> Result {
+    auto result = Result{detail::invoke(std::forward<NullaryFunction>(alternative))};
+    if (fusion<Result>::has_value(result)) {
+        return result;
+    }
+    return first_of_sequential<Result>(std::forward<NullaryFunctions>(rest)...);
+}
+
+/***
+ * State shared by the alternatives of a hedged first_of, where the first alternative that comes back non-empty, or the
+ * last one to come back when all are empty, satisfies the result.
+ */
+template <typename Result, typename Executor, typename... NullaryFunctions>
+struct first_of_state final {
+    static constexpr std::size_t size = sizeof...(NullaryFunctions);
+    static constexpr std::size_t none = size;
+
+    std::tuple<NullaryFunctions...> alternatives;
+    Executor *executor;
+    std::chrono::steady_clock::duration delay;
+    std::mutex mutex;
+    std::size_t launched = 0;
+    std::size_t failed = 0;
+    bool is_done = false;
+    support::cancellation_source cancellation;
+    support::promise<Result> output;
+
+    template <typename... Fs>
+    explicit first_of_state(Executor &executor, std::chrono::steady_clock::duration delay, Fs &&... fs)
+        : alternatives{std::forward<Fs>(fs)...}, executor{&executor}, delay{delay} {
+    }
+
+    /***
+     * Reserves the launch of the alternative at index, unless the result has been satisfied, or it has already been
+     * launched because the ones before it came back empty.
+     */
+    auto reserve(std::size_t index) -> bool {
+        auto const lock = std::lock_guard{mutex};
+        if (is_done || launched != index) {
+            return false;
+        }
+        ++launched;
+        return true;
+    }
+
+    /***
+     * Records that an alternative has come back, and whether it satisfies the result. When it's empty, and so are all
+     * the ones launched so far, it also reserves the launch of the next alternative, whose index it stores into next.
+     */
+    auto try_finish(bool is_failure, std::size_t &next) -> bool {
+        auto const lock = std::lock_guard{mutex};
+        if (is_done) {
+            return false;
+        }
+        if (is_failure && ++failed < size) {
+            if (failed == launched) {
+                next = launched++;
+            }
+            return false;
+        }
+        is_done = true;
+        return true;
+    }
+
+    auto fail(std::exception_ptr exception) -> void {
+        auto next = none;
+        if (try_finish(false, next)) {
+            cancellation.cancel();
+            output.set_exception(std::move(exception));
+        }
+    }
+
+    /***
+     * @return the index of the next alternative to launch right away, or none.
+     */
+    auto complete(Result &&nullable) -> std::size_t {
+        auto next = none;
+        if (try_finish(!fusion<Result>::has_value(nullable), next)) {
+            cancellation.cancel();
+            output.set_value(std::move(nullable));
+        }
+        return next;
+    }
+};
+
+template <std::size_t I, typename State>
+auto launch_alternative(std::shared_ptr<State> const &state) -> void;
+
+template <typename State, std::size_t... Is>
+auto launch_at(std::shared_ptr<State> const &state, std::size_t index, std::index_sequence<Is...>) -> void {
+    (void)((index == Is ? (launch_alternative<Is>(state), true) : false) || ...);
+}
+
+/***
+ * Launches the alternative I on the executor, and schedules the launch of the next one once the delay has passed on
+ * support::timer, rather than waiting for it on a thread of the executor. Since the timer only refers weakly to the
+ * state, a launch that is no longer needed doesn't keep it alive.
+ */
+template <std::size_t I, typename State>
+auto launch_alternative(std::shared_ptr<State> const &state) -> void {
+    state->executor->execute([state] {
+        auto const token = state->cancellation.token();
+        if (token.is_cancelled()) {
+            return;
+        }
+        try {
+            if (auto const next = state->complete(invoke_branch(std::get<I>(state->alternatives), token));
+                next != State::none) {
+                launch_at(state, next, std::make_index_sequence<State::size>{});
+            }
+        } catch (...) {
+            state->fail(std::current_exception());
+        }
+    });
+    if constexpr (I + 1 < State::size) {
+        support::timer::instance().schedule_at(std::chrono::steady_clock::now() + state->delay,
+                                               [weak = std::weak_ptr<State>{state}] {
+                                                   if (auto const locked = weak.lock(); locked && locked->reserve(I + 1)) {
+                                                       launch_alternative<I + 1>(locked);
+                                                   }
+                                               });
+    }
+}
+
+template <typename NullaryFunction>
+using alternative_result_t = std::decay_t<branch_result_t<std::decay_t<NullaryFunction>>>;
+
+}
+
+/***
+ * Given the nullary functions f1: void -> N<A>, ..., fn: void -> N<A> returning the same nullable type (i.e.
+ * optional-like object), e.g. a primary cache, a replica, and an origin, it calls them lazily in order:
+ * - When any of them returns a non-empty nullable: it should return it without calling the remaining functions.
+ * - When all of them return an empty nullable: it should return the empty nullable returned by the last one.
+ *
+ * @param alternatives nullary functions void -> N<A>, in the order they are tried.
+ * @return the first non-empty nullable returned by the alternatives, or else the last empty one.
+ */
+template <typename NullaryFunction, typename... NullaryFunctions,
+          std::enable_if_t<std::is_invocable_v<NullaryFunction &>, int> = 0>
+constexpr auto first_of(NullaryFunction &&alternative, NullaryFunctions &&... rest) {
+    using Result = std::decay_t<decltype(detail::invoke(alternative))>;
+    static_assert((std::is_same_v<std::decay_t<decltype(detail::invoke(rest))>, Result> && ...),
+                  "All the alternatives must return the same nullable type");
+    return detail::first_of_sequential<Result>(std::forward<NullaryFunction>(alternative),
+                                               std::forward<NullaryFunctions>(rest)...);
+}
+
+/***
+ * Given an executor, a delay, and the nullary functions f1: void -> N<A>, ..., fn: void -> N<A> returning the same
+ * nullable type (i.e. optional-like object), it hedges them on the executor: it launches f1 first, and then launches
+ * each next function once the delay has passed without a result, or as soon as all the functions launched so far have
+ * returned an empty nullable, such that a slow alternative doesn't add up its latency to the next ones:
+ * - When any of them returns a non-empty nullable: it should satisfy the returned future with it as soon as that
+ * happens, and cancel the remaining functions.
+ * - When all of them return an empty nullable: it should satisfy the returned future with the empty nullable returned
+ * by the last one to come back.
+ *
+ * The delays are awaited by support::timer rather than by a thread of the executor, hence the executor only runs the
+ * functions themselves, although it should have as many threads as functions to overlap them fully.
+ *
+ * Cancellation is cooperative: a function that is not yet running when cancelled is skipped, whereas a function that
+ * accepts a support::cancellation_token may poll it to stop early. Exceptions thrown by a function are stored in the
+ * returned future and also cancel the remaining functions.
+ *
+ * @param executor an object whose member function execute(g) eventually invokes g, and which outlives the functions.
+ * @param delay how long to wait for an alternative before launching the next one as well.
+ * @param alternatives nullary functions void -> N<A>, or unary functions cancellation_token -> N<A>, in order.
+ * @return a future of the first non-empty nullable returned by the alternatives, or else of the last empty one.
+ */
+template <typename Executor, typename Rep, typename Period, typename... NullaryFunctions>
+auto first_of(Executor &executor, std::chrono::duration<Rep, Period> delay, NullaryFunctions &&... alternatives) {
+    static_assert(sizeof...(NullaryFunctions) > 0, "first_of needs at least one function");
+    using Result = std::tuple_element_t<0, std::tuple<detail::alternative_result_t<NullaryFunctions>...>>;
+    static_assert((std::is_same_v<detail::alternative_result_t<NullaryFunctions>, Result> && ...),
+                  "All the alternatives must return the same nullable type");
+    using State = detail::first_of_state<Result, Executor, std::decay_t<NullaryFunctions>...>;
+
+    auto const state =
+        std::make_shared<State>(executor, std::chrono::duration_cast<std::chrono::steady_clock::duration>(delay),
+                                std::forward<NullaryFunctions>(alternatives)...);
+    auto result = state->output.get_future();
+    state->reserve(0);
+    detail::launch_alternative<0>(state);
+    return result;
+}
+
+}
+
+#endif
@@ -1,7 +1,11 @@
 #ifndef RVARAGO_ABSENT_FOREACH_H
 #define RVARAGO_ABSENT_FOREACH_H
 
-#include <functional>
+#include "absent/support/instrumented.h"
+#include "absent/support/invoke.h"
+#include "absent/support/non_owning.h"
+
+#include <type_traits>
 #include <utility>
 
 namespace rvarago::absent {
@@ -16,10 +20,27 @@ namespace rvarago::absent {
  */
 template <template <typename> typename Nullable, typename UnaryFunction, typename A>
 constexpr auto for_each(Nullable<A> const &input,
-                        UnaryFunction &&action) noexcept(noexcept(std::invoke(std::declval<UnaryFunction>(),
-                                                                              std::declval<A>()))) -> void {
+                        UnaryFunction &&action) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                 std::declval<A>()))) -> void {
+    if (input) {
+        detail::invoke(std::forward<UnaryFunction>(action), *input);
+    } else if constexpr (detail::is_instrumented_v<std::decay_t<UnaryFunction>>) {
+        action.record_short_circuit();
+    }
+}
+
+/***
+ * Overload of for_each for an rvalue nullable N<A>, whose wrapped value of type A is moved into the action.
+ */
+template <template <typename> typename Nullable, typename UnaryFunction, typename A,
+          std::enable_if_t<!detail::is_non_owning_v<Nullable<A>>, int> = 0>
+constexpr auto for_each(Nullable<A> &&input,
+                        UnaryFunction &&action) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                 std::declval<A>()))) -> void {
     if (input) {
-        std::invoke(std::forward<UnaryFunction>(action), *input);
+        detail::invoke(std::forward<UnaryFunction>(action), std::move(*input));
+    } else if constexpr (detail::is_instrumented_v<std::decay_t<UnaryFunction>>) {
+        action.record_short_circuit();
     }
 }
 
@@ -0,0 +1,258 @@
+#ifndef RVARAGO_ABSENT_FUSE_H
+#define RVARAGO_ABSENT_FUSE_H
+
+#include "absent/support/invoke.h"
+#include "absent/support/non_owning.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent {
+
+/***
+ * A deferred pipeline made of the stages collected in Previous followed by Stage. It does not evaluate anything by
+ * itself, but rather it's applied to a nullable by run (or its infix version operator|) which executes all the stages
+ * as a single fused function.
+ *
+ * The empty pipeline, i.e. the one returned by fuse(), is represented by fused<void, void>.
+ */
+template <typename Previous, typename Stage>
+struct fused final {
+    Previous previous;
+    Stage stage;
+};
+
+template <>
+struct fused<void, void> final {};
+
+namespace detail {
+
+/***
+ * Describes how a deferred pipeline inspects and unwraps a nullable type N.
+ *
+ * Specialisations must provide:
+ * - rebind<B>: the nullable type of the same kind as N wrapping a B.
+ * - has_value(n): whether n is not empty.
+ * - value(n): the value wrapped inside n, which must not be empty.
+ * - propagate<Result>(n): a new empty Result built from n, which must be empty.
+ *
+ * Specialisations may also provide:
+ * - empty(): a new empty N, when one may be made out of nothing. Nullables whose emptiness carries information, such as
+ * the error of an either, don't provide it.
+ */
+template <typename N>
+struct fusion;
+
+template <template <typename> typename Nullable, typename A>
+struct fusion<Nullable<A>> final {
+    template <typename B>
+    using rebind = rebind_t<Nullable, B>;
+
+    static constexpr auto has_value(Nullable<A> const &n) noexcept -> bool {
+        return static_cast<bool>(n);
+    }
+
+    static constexpr auto value(Nullable<A> const &n) noexcept -> A const & {
+        return *n;
+    }
+
+    static constexpr auto value(Nullable<A> &&n) noexcept -> decltype(auto) {
+        if constexpr (detail::is_non_owning_v<Nullable<A>>) {
+            return *n;
+        } else {
+            return std::move(*n);
+        }
+    }
+
+    template <typename Result>
+    static constexpr auto propagate(Nullable<A> const &) noexcept -> Result {
+        return Result{};
+    }
+
+    static constexpr auto empty() noexcept -> Nullable<A> {
+        return Nullable<A>{};
+    }
+};
+
+/***
+ * Whether N is a nullable type described by fusion<N>.
+ */
+template <typename N, typename = void>
+inline constexpr bool is_fusable_v = false;
+
+template <typename N>
+inline constexpr bool is_fusable_v<N, std::void_t<decltype(fusion<N>::has_value(std::declval<N const &>()))>> = true;
+
+/***
+ * Whether an empty N may be made out of nothing by fusion<N>::empty().
+ */
+template <typename N, typename = void>
+inline constexpr bool has_empty_v = false;
+
+template <typename N>
+inline constexpr bool has_empty_v<N, std::void_t<decltype(fusion<N>::empty())>> = true;
+
+/***
+ * Whether the nullable types M and N are of the same kind, i.e. they only differ by the type of the wrapped value.
+ */
+template <typename M, typename N>
+inline constexpr bool is_same_kind_v =
+    std::is_same_v<typename fusion<M>::template rebind<int>, typename fusion<N>::template rebind<int>>;
+
+/***
+ * The last continuation of a pipeline, which wraps the final value into a nullable of the same kind as the input.
+ */
+template <typename Fusion>
+struct wrap final {
+    template <typename B>
+    constexpr auto operator()(B &&value) const -> typename Fusion::template rebind<std::decay_t<B>> {
+        return typename Fusion::template rebind<std::decay_t<B>>{std::forward<B>(value)};
+    }
+};
+
+template <typename Then>
+inline constexpr bool is_wrap_v = false;
+
+template <typename Fusion>
+inline constexpr bool is_wrap_v<wrap<Fusion>> = true;
+
+template <typename UnaryFunction>
+struct transform_stage final {
+    UnaryFunction mapper;
+
+    template <typename A, typename Then>
+    constexpr auto operator()(A &&value, Then &&then) const {
+        return std::forward<Then>(then)(detail::invoke(mapper, std::forward<A>(value)));
+    }
+};
+
+template <typename UnaryFunction>
+struct and_then_stage final {
+    UnaryFunction mapper;
+
+    template <typename A, typename Then>
+    constexpr auto operator()(A &&value, Then &&then) const {
+        auto next = detail::invoke(mapper, std::forward<A>(value));
+        using Fusion = fusion<decltype(next)>;
+        using Result = decltype(std::forward<Then>(then)(Fusion::value(std::move(next))));
+        if constexpr (is_wrap_v<std::decay_t<Then>> && std::is_same_v<Result, decltype(next)>) {
+            return next;
+        } else {
+            if (!Fusion::has_value(next)) {
+                return Fusion::template propagate<Result>(std::move(next));
+            }
+            return std::forward<Then>(then)(Fusion::value(std::move(next)));
+        }
+    }
+};
+
+/***
+ * Feeds value through all the stages of pipeline in order, each stage calling the next one as its continuation, and
+ * finally calls then with the resulting value.
+ */
+template <typename Previous, typename Stage, typename A, typename Then>
+constexpr auto feed(fused<Previous, Stage> const &pipeline, A &&value, Then &&then) {
+    if constexpr (std::is_void_v<Stage>) {
+        return std::forward<Then>(then)(std::forward<A>(value));
+    } else {
+        return feed(pipeline.previous, std::forward<A>(value),
+                    [&](auto &&x) { return pipeline.stage(std::forward<decltype(x)>(x), then); });
+    }
+}
+
+template <typename Nullable, typename Previous, typename Stage>
+constexpr auto run(Nullable &&input, fused<Previous, Stage> const &pipeline) {
+    using Fusion = fusion<std::remove_cv_t<std::remove_reference_t<Nullable>>>;
+    using Result = decltype(feed(pipeline, Fusion::value(std::forward<Nullable>(input)), wrap<Fusion>{}));
+    if (!Fusion::has_value(input)) {
+        return Fusion::template propagate<Result>(std::forward<Nullable>(input));
+    } else {
+        return feed(pipeline, Fusion::value(std::forward<Nullable>(input)), wrap<Fusion>{});
+    }
+}
+
+}
+
+/***
+ * Starts a new deferred pipeline, to which stages are appended by operator| (transform) and operator>> (and_then).
+ *
+ * @return an empty pipeline.
+ */
+constexpr auto fuse() noexcept -> fused<void, void> {
+    return fused<void, void>{};
+}
+
+/***
+ * Given a deferred pipeline and an unary function f: A -> B, appends a transform stage that maps over the value
+ * produced by the pipeline.
+ *
+ * @param pipeline a deferred pipeline.
+ * @param mapper an unary function A -> B.
+ * @return a new deferred pipeline whose last stage is mapper.
+ */
+template <typename Previous, typename Stage, typename UnaryFunction>
+constexpr auto operator|(fused<Previous, Stage> pipeline, UnaryFunction &&mapper)
+    -> fused<fused<Previous, Stage>, detail::transform_stage<std::decay_t<UnaryFunction>>> {
+    return {std::move(pipeline), {std::forward<UnaryFunction>(mapper)}};
+}
+
+/***
+ * Given a deferred pipeline and an unary function f: A -> N<B>, appends an and_then stage that binds the value
+ * produced by the pipeline.
+ *
+ * @param pipeline a deferred pipeline.
+ * @param mapper an unary function A -> N<B>.
+ * @return a new deferred pipeline whose last stage is mapper.
+ */
+template <typename Previous, typename Stage, typename UnaryFunction>
+constexpr auto operator>>(fused<Previous, Stage> pipeline, UnaryFunction &&mapper)
+    -> fused<fused<Previous, Stage>, detail::and_then_stage<std::decay_t<UnaryFunction>>> {
+    return {std::move(pipeline), {std::forward<UnaryFunction>(mapper)}};
+}
+
+/***
+ * Given a nullable type N<A> (i.e. optional-like object), and a deferred pipeline whose stages map A into B:
+ * - When empty: it should return a new empty nullable N<B> without evaluating any stage.
+ * - When *not* empty: it should feed the input value through all stages, stopping at the first one that returns an
+ * empty nullable, and return the final value wrapped in a nullable N<B>.
+ *
+ * No intermediate nullable is materialised between transform stages, and each and_then stage is checked only once.
+ *
+ * @param input a nullable N<A>.
+ * @param pipeline a deferred pipeline built from fuse().
+ * @return a new nullable containing the value produced by the pipeline, possibly empty if any stage was also empty.
+ */
+template <template <typename> typename Nullable, typename A, typename Previous, typename Stage>
+constexpr auto run(Nullable<A> const &input, fused<Previous, Stage> const &pipeline) {
+    return detail::run(input, pipeline);
+}
+
+/***
+ * Overload of run for an rvalue nullable N<A>, whose wrapped value of type A is moved into the first stage.
+ */
+template <template <typename> typename Nullable, typename A, typename Previous, typename Stage,
+          std::enable_if_t<!detail::is_non_owning_v<Nullable<A>>, int> = 0>
+constexpr auto run(Nullable<A> &&input, fused<Previous, Stage> const &pipeline) {
+    return detail::run(std::move(input), pipeline);
+}
+
+/***
+ * Infix version of run.
+ */
+template <template <typename> typename Nullable, typename A, typename Previous, typename Stage>
+constexpr auto operator|(Nullable<A> const &input, fused<Previous, Stage> const &pipeline) {
+    return detail::run(input, pipeline);
+}
+
+/***
+ * Infix version of run for an rvalue nullable N<A>.
+ */
+template <template <typename> typename Nullable, typename A, typename Previous, typename Stage,
+          std::enable_if_t<!detail::is_non_owning_v<Nullable<A>>, int> = 0>
+constexpr auto operator|(Nullable<A> &&input, fused<Previous, Stage> const &pipeline) {
+    return detail::run(std::move(input), pipeline);
+}
+
+}
+
+#endif
@@ -0,0 +1,331 @@
+#ifndef RVARAGO_ABSENT_INSTRUMENTATION_H
+#define RVARAGO_ABSENT_INSTRUMENTATION_H
+
+#include "absent/support/instrumented.h"
+#include "absent/support/invoke.h"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef RVARAGO_ABSENT_INSTRUMENTATION
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#endif
+
+#ifndef RVARAGO_ABSENT_INSTRUMENTATION_MAX_STAGES
+#define RVARAGO_ABSENT_INSTRUMENTATION_MAX_STAGES 256
+#endif
+
+namespace rvarago::absent::instrumentation {
+
+/**
+ * The statistics of a named stage, aggregated across all threads.
+ */
+struct stage_statistics final {
+    std::string name;
+
+    // How many times the stage was called.
+    std::uint64_t taken = 0;
+
+    // How many times the stage was skipped because its input was empty (or in error).
+    std::uint64_t short_circuited = 0;
+
+    // How many times the stage returned an empty nullable (or in error).
+    std::uint64_t failed = 0;
+
+    // How long the stage took in total, when it's timed.
+    std::uint64_t nanoseconds = 0;
+};
+
+/**
+ * Receives the statistics of the named stages, e.g. to export them to a metrics system.
+ */
+class metrics_sink {
+  public:
+    virtual ~metrics_sink() = default;
+
+    virtual auto record(stage_statistics const &statistics) -> void = 0;
+};
+
+// Whatever depends on RVARAGO_ABSENT_INSTRUMENTATION lives in an inline namespace named after whether it's defined,
+// such that translation units built with and without it have distinct symbols, rather than conflicting definitions.
+#ifdef RVARAGO_ABSENT_INSTRUMENTATION
+inline namespace enabled {
+#else
+inline namespace disabled {
+#endif
+
+#ifdef RVARAGO_ABSENT_INSTRUMENTATION
+
+namespace detail {
+
+/**
+ * Counters of a stage in a given thread, written only by that thread, such that they are updated without locking.
+ */
+struct stage_counters final {
+    std::atomic<std::uint64_t> taken{0};
+    std::atomic<std::uint64_t> short_circuited{0};
+    std::atomic<std::uint64_t> failed{0};
+    std::atomic<std::uint64_t> nanoseconds{0};
+};
+
+inline auto add(std::atomic<std::uint64_t> &counter, std::uint64_t amount) noexcept -> void {
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+inline constexpr std::size_t max_stages = RVARAGO_ABSENT_INSTRUMENTATION_MAX_STAGES;
+
+using thread_counters = std::array<stage_counters, max_stages>;
+
+/**
+ * Keeps the names of the stages, the counters of the running threads, and the totals of the threads that have exited.
+ */
+class registry final {
+    std::mutex _mutex;
+    std::vector<std::string> _names;
+    std::vector<thread_counters const *> _threads;
+    std::array<stage_statistics, max_stages> _retired{};
+
+    template <typename Counters>
+    static auto accumulate(stage_statistics &total, Counters const &counters) -> void {
+        total.taken += counters.taken.load(std::memory_order_relaxed);
+        total.short_circuited += counters.short_circuited.load(std::memory_order_relaxed);
+        total.failed += counters.failed.load(std::memory_order_relaxed);
+        total.nanoseconds += counters.nanoseconds.load(std::memory_order_relaxed);
+    }
+
+  public:
+    static auto instance() -> registry & {
+        static registry global;
+        return global;
+    }
+
+    auto id_of(char const *name) -> std::size_t {
+        auto const lock = std::lock_guard{_mutex};
+        for (std::size_t id = 0; id < _names.size(); ++id) {
+            if (_names[id] == name) {
+                return id;
+            }
+        }
+        if (_names.size() == max_stages) {
+            throw std::length_error{"Too many named stages, see RVARAGO_ABSENT_INSTRUMENTATION_MAX_STAGES"};
+        }
+        _names.emplace_back(name);
+        return _names.size() - 1;
+    }
+
+    auto attach(thread_counters const &counters) -> void {
+        auto const lock = std::lock_guard{_mutex};
+        _threads.push_back(&counters);
+    }
+
+    auto detach(thread_counters const &counters) -> void {
+        auto const lock = std::lock_guard{_mutex};
+        for (std::size_t id = 0; id < _names.size(); ++id) {
+            accumulate(_retired[id], counters[id]);
+        }
+        _threads.erase(std::remove(_threads.begin(), _threads.end(), &counters), _threads.end());
+    }
+
+    auto snapshot() -> std::vector<stage_statistics> {
+        auto const lock = std::lock_guard{_mutex};
+        auto statistics = std::vector<stage_statistics>(_names.size());
+        for (std::size_t id = 0; id < _names.size(); ++id) {
+            statistics[id] = _retired[id];
+            statistics[id].name = _names[id];
+            for (auto const *counters : _threads) {
+                accumulate(statistics[id], (*counters)[id]);
+            }
+        }
+        return statistics;
+    }
+};
+
+/**
+ * The counters of the current thread, which are attached to the registry during the lifetime of the thread.
+ */
+class local_counters final {
+    thread_counters _counters{};
+
+  public:
+    local_counters() {
+        registry::instance().attach(_counters);
+    }
+
+    local_counters(local_counters const &) = delete;
+    auto operator=(local_counters const &) -> local_counters & = delete;
+
+    ~local_counters() {
+        registry::instance().detach(_counters);
+    }
+
+    static auto of(std::size_t id) -> stage_counters & {
+        thread_local local_counters local;
+        return local._counters[id];
+    }
+};
+
+template <typename Result, typename = void>
+inline constexpr bool is_nullable_result_v = false;
+
+template <typename Result>
+inline constexpr bool is_nullable_result_v<Result, std::void_t<decltype(std::declval<Result const &>().has_value())>> =
+    true;
+
+/**
+ * Wraps a stage such that calling it, or skipping it, updates its counters.
+ */
+template <typename UnaryFunction, bool Timed>
+class named_stage final {
+    UnaryFunction _f;
+    std::size_t _id;
+
+  public:
+    named_stage(UnaryFunction f, std::size_t id) : _f{std::move(f)}, _id{id} {
+    }
+
+    template <typename... Args>
+    auto operator()(Args &&... args) const -> std::invoke_result_t<UnaryFunction const &, Args &&...> {
+        using Result = std::invoke_result_t<UnaryFunction const &, Args &&...>;
+        auto &counters = local_counters::of(_id);
+        add(counters.taken, 1);
+        [[maybe_unused]] auto const start =
+            Timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+        if constexpr (std::is_void_v<Result>) {
+            absent::detail::invoke(_f, std::forward<Args>(args)...);
+            record_elapsed(counters, start);
+        } else {
+            auto result = absent::detail::invoke(_f, std::forward<Args>(args)...);
+            record_elapsed(counters, start);
+            if constexpr (is_nullable_result_v<Result>) {
+                if (!result.has_value()) {
+                    add(counters.failed, 1);
+                }
+            }
+            return result;
+        }
+    }
+
+    auto record_short_circuit() const -> void {
+        add(local_counters::of(_id).short_circuited, 1);
+    }
+
+  private:
+    static auto record_elapsed([[maybe_unused]] stage_counters &counters,
+                               [[maybe_unused]] std::chrono::steady_clock::time_point start) -> void {
+        if constexpr (Timed) {
+            auto const elapsed = std::chrono::steady_clock::now() - start;
+            add(counters.nanoseconds,
+                static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+    }
+};
+
+}
+
+#endif
+
+/**
+ * The name of a stage resolved into its counters, which takes a global lock and compares the name against those of the
+ * other stages. Hence, a stage built on every call should resolve its name only once, e.g.
+ * static instrumentation::stage_id const find_address_id{"find_address"}, and be named with it.
+ *
+ * Unless RVARAGO_ABSENT_INSTRUMENTATION is defined, it's empty.
+ */
+class stage_id final {
+#ifdef RVARAGO_ABSENT_INSTRUMENTATION
+    std::size_t _id;
+
+  public:
+    explicit stage_id(char const *name) : _id{detail::registry::instance().id_of(name)} {
+    }
+
+    auto value() const noexcept -> std::size_t {
+        return _id;
+    }
+#else
+  public:
+    constexpr explicit stage_id(char const *) noexcept {
+    }
+#endif
+};
+
+/**
+ * Names a stage f of a chain, e.g. input >> named("find_address", find_address), such that its counters are recorded:
+ * how many times it's called, how many times it's skipped because its input is empty (or in error), and how many times
+ * it returns an empty nullable (or in error). Counters are kept per thread, hence updating them doesn't need locking.
+ *
+ * Since naming a stage resolves its name, see stage_id, a stage should rather be named once and then reused, or be
+ * named with a stage_id resolved once.
+ *
+ * Unless RVARAGO_ABSENT_INSTRUMENTATION is defined, it returns f itself, hence it has no overhead at all.
+ *
+ * @param id the name of the stage, or its stage_id, where stages of the same name share their counters.
+ * @param f the stage.
+ * @return f, possibly wrapped such that its counters are recorded.
+ */
+template <typename UnaryFunction>
+auto named([[maybe_unused]] stage_id id, UnaryFunction &&f) {
+#ifdef RVARAGO_ABSENT_INSTRUMENTATION
+    return detail::named_stage<std::decay_t<UnaryFunction>, false>{std::forward<UnaryFunction>(f), id.value()};
+#else
+    return std::decay_t<UnaryFunction>{std::forward<UnaryFunction>(f)};
+#endif
+}
+
+template <typename UnaryFunction>
+auto named(char const *name, UnaryFunction &&f) {
+    return named(stage_id{name}, std::forward<UnaryFunction>(f));
+}
+
+/**
+ * Same as named, but it also measures how long the stage takes.
+ */
+template <typename UnaryFunction>
+auto timed([[maybe_unused]] stage_id id, UnaryFunction &&f) {
+#ifdef RVARAGO_ABSENT_INSTRUMENTATION
+    return detail::named_stage<std::decay_t<UnaryFunction>, true>{std::forward<UnaryFunction>(f), id.value()};
+#else
+    return std::decay_t<UnaryFunction>{std::forward<UnaryFunction>(f)};
+#endif
+}
+
+template <typename UnaryFunction>
+auto timed(char const *name, UnaryFunction &&f) {
+    return timed(stage_id{name}, std::forward<UnaryFunction>(f));
+}
+
+/**
+ * @return the statistics of all the named stages, aggregated across all threads, or nothing unless
+ * RVARAGO_ABSENT_INSTRUMENTATION is defined.
+ */
+inline auto statistics() -> std::vector<stage_statistics> {
+#ifdef RVARAGO_ABSENT_INSTRUMENTATION
+    return detail::registry::instance().snapshot();
+#else
+    return {};
+#endif
+}
+
+/**
+ * Sends the statistics of all the named stages to sink.
+ */
+inline auto export_statistics(metrics_sink &sink) -> void {
+    for (auto const &stage : statistics()) {
+        sink.record(stage);
+    }
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef RVARAGO_ABSENT_LIFT_H
+#define RVARAGO_ABSENT_LIFT_H
+
+#include "absent/support/invoke.h"
+#include "absent/zip.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent {
+
+/***
+ * Given a function f: (A1, ..., An) -> B, it returns a new function that, given the nullable types N<A1>, ..., N<An> of
+ * the same kind (i.e. optional-like objects):
+ * - When any of them is empty: it should return a new empty nullable N<B>, propagated from the first empty input.
+ * - When none of them is empty: it should return a new nullable N<B> wrapping the result of f called with their values.
+ *
+ * The presence of the inputs is checked only once for all of them, and f receives references to the values wrapped
+ * inside the inputs, which are rvalue references for rvalue inputs, hence nothing is copied.
+ *
+ * @param mapper a function (A1, ..., An) -> B.
+ * @return a new function (N<A1>, ..., N<An>) -> N<B>.
+ */
+template <typename Function>
+constexpr auto lift(Function &&mapper) {
+    return [mapper = std::forward<Function>(mapper)](auto &&input, auto &&... inputs) {
+        static_assert(detail::are_same_kind_v<decltype(input), decltype(inputs)...>,
+                      "All the inputs must be nullables of the same kind");
+        using Fusion = detail::fusion_of<decltype(input)>;
+        using B = decltype(detail::invoke(mapper, Fusion::value(std::forward<decltype(input)>(input)),
+                                          detail::fusion_of<decltype(inputs)>::value(
+                                           std::forward<decltype(inputs)>(inputs))...));
+        using Result = typename Fusion::template rebind<B>;
+        if (!detail::all_have_value(input, inputs...)) {
+            return detail::propagate_first<Result>(std::forward<decltype(input)>(input),
+                                                   std::forward<decltype(inputs)>(inputs)...);
+        }
+        return Result{
+            detail::invoke(mapper, Fusion::value(std::forward<decltype(input)>(input)),
+                           detail::fusion_of<decltype(inputs)>::value(std::forward<decltype(inputs)>(inputs))...)};
+    };
+}
+
+}
+
+#endif
@@ -0,0 +1,328 @@
+#ifndef RVARAGO_ABSENT_MEMOIZE_H
+#define RVARAGO_ABSENT_MEMOIZE_H
+
+#include "absent/support/invoke.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rvarago::absent {
+
+/**
+ * Which entry a full shard of a memoized function evicts.
+ */
+enum class eviction {
+    // The least recently used entry, which reorders the entries of a shard on every hit.
+    lru,
+
+    // An approximation of LRU that only marks an entry on a hit, and evicts the first unmarked one found by a hand
+    // sweeping the entries of a shard, hence hits are cheaper.
+    clock,
+};
+
+/**
+ * How a memoized function caches the results.
+ */
+struct memoize_options final {
+    // How many results are cached at most, split evenly across the shards.
+    std::size_t capacity = 1024;
+
+    // How many independently locked shards the cache is split into, to reduce contention.
+    std::size_t shards = 16;
+
+    // How long a non-empty result stays cached, or forever when zero.
+    std::chrono::steady_clock::duration ttl = std::chrono::steady_clock::duration::zero();
+
+    // How long an empty result stays cached, or forever when zero.
+    std::chrono::steady_clock::duration failure_ttl = std::chrono::steady_clock::duration::zero();
+
+    // Whether empty results are cached too, i.e. negative caching.
+    bool cache_failures = true;
+
+    eviction policy = eviction::lru;
+};
+
+/**
+ * How often a memoized function found the results in its cache.
+ */
+struct memoize_statistics final {
+    // Calls that found a cached result.
+    std::uint64_t hits = 0;
+
+    // Calls that waited for a concurrent call with the same key, sharing its computation.
+    std::uint64_t shared = 0;
+
+    // Calls that computed a result.
+    std::uint64_t misses = 0;
+
+    // Results that were evicted to make room for others, or because they expired.
+    std::uint64_t evictions = 0;
+
+    /**
+     * @return the ratio of calls that didn't compute a result, or 0 before any call.
+     */
+    auto hit_rate() const noexcept -> double {
+        auto const calls = hits + shared + misses;
+        return calls == 0 ? 0.0 : static_cast<double>(hits + shared) / static_cast<double>(calls);
+    }
+};
+
+namespace detail {
+
+/***
+ * A shard of the cache of a memoized function, whose entries are kept in a list in recency order for LRU, or swept by a
+ * hand for CLOCK, and indexed by key.
+ */
+template <typename Key, typename Result, typename Hash>
+class memo_shard final {
+    using clock = std::chrono::steady_clock;
+
+    struct entry final {
+        Key key;
+        Result result;
+        std::optional<clock::time_point> expires_at;
+        bool referenced;
+    };
+
+    using entries_t = std::list<entry>;
+
+    std::mutex _mutex;
+    entries_t _entries;
+    std::unordered_map<Key, typename entries_t::iterator, Hash> _index;
+    std::unordered_map<Key, std::shared_future<Result>, Hash> _in_flight;
+    typename entries_t::iterator _hand = _entries.end();
+    memoize_statistics _statistics;
+
+    auto erase(typename entries_t::iterator position) -> void {
+        if (_hand == position) {
+            ++_hand;
+        }
+        _index.erase(position->key);
+        _entries.erase(position);
+        ++_statistics.evictions;
+    }
+
+    auto evict_one(eviction policy) -> void {
+        if (policy == eviction::lru) {
+            erase(std::prev(_entries.end()));
+            return;
+        }
+        for (;;) {
+            if (_hand == _entries.end()) {
+                _hand = _entries.begin();
+            }
+            if (!_hand->referenced) {
+                erase(_hand);
+                return;
+            }
+            _hand->referenced = false;
+            ++_hand;
+        }
+    }
+
+  public:
+    /***
+     * Looks up key, or joins a computation in flight for it, or else registers a new one whose promise the caller must
+     * fulfil via complete() or abandon().
+     */
+    struct lookup final {
+        std::optional<Result> cached;
+        std::optional<std::shared_future<Result>> in_flight;
+        std::optional<std::promise<Result>> promise;
+    };
+
+    auto find(Key const &key, eviction policy) -> lookup {
+        auto const lock = std::lock_guard{_mutex};
+        if (auto const found = _index.find(key); found != _index.end()) {
+            auto const position = found->second;
+            if (!position->expires_at || clock::now() < *position->expires_at) {
+                ++_statistics.hits;
+                if (policy == eviction::lru) {
+                    _entries.splice(_entries.begin(), _entries, position);
+                } else {
+                    position->referenced = true;
+                }
+                return lookup{position->result, std::nullopt, std::nullopt};
+            }
+            erase(position);
+        }
+        if (auto const found = _in_flight.find(key); found != _in_flight.end()) {
+            ++_statistics.shared;
+            return lookup{std::nullopt, found->second, std::nullopt};
+        }
+        ++_statistics.misses;
+        auto promise = std::promise<Result>{};
+        _in_flight.emplace(key, promise.get_future().share());
+        return lookup{std::nullopt, std::nullopt, std::move(promise)};
+    }
+
+    auto complete(Key const &key, Result const &result, memoize_options const &options, std::size_t capacity) -> void {
+        auto const lock = std::lock_guard{_mutex};
+        _in_flight.erase(key);
+        auto const has_value = static_cast<bool>(result.has_value());
+        if (!has_value && !options.cache_failures) {
+            return;
+        }
+        if (auto const found = _index.find(key); found != _index.end()) {
+            erase(found->second);
+        }
+        if (_entries.size() >= capacity) {
+            evict_one(options.policy);
+        }
+        auto const ttl = has_value ? options.ttl : options.failure_ttl;
+        auto expires_at = ttl == clock::duration::zero() ? std::nullopt : std::optional{clock::now() + ttl};
+        if (options.policy == eviction::lru) {
+            _entries.push_front(entry{key, result, expires_at, false});
+            _index.emplace(key, _entries.begin());
+        } else {
+            // Just behind the hand, hence a new entry is the last one the hand reaches, and it survives a full sweep.
+            _index.emplace(key, _entries.insert(_hand, entry{key, result, expires_at, false}));
+        }
+    }
+
+    auto abandon(Key const &key) -> void {
+        auto const lock = std::lock_guard{_mutex};
+        _in_flight.erase(key);
+    }
+
+    auto statistics() -> memoize_statistics {
+        auto const lock = std::lock_guard{_mutex};
+        return _statistics;
+    }
+
+    auto clear() -> void {
+        auto const lock = std::lock_guard{_mutex};
+        _index.clear();
+        _entries.clear();
+        _hand = _entries.end();
+    }
+};
+
+}
+
+/**
+ * An unary function Key -> N<B> (e.g. std::optional<B> or either<B, E>) that caches its results, as returned by
+ * memoize().
+ *
+ * Copies share the same cache, which is safe to use from several threads concurrently.
+ */
+template <typename Key, typename UnaryFunction, typename Hash = std::hash<Key>>
+class memoized final {
+  public:
+    using result_type = std::decay_t<decltype(detail::invoke(std::declval<UnaryFunction const &>(),
+                                                             std::declval<Key const &>()))>;
+
+  private:
+    using shard_t = detail::memo_shard<Key, result_type, Hash>;
+
+    struct state final {
+        UnaryFunction mapper;
+        memoize_options options;
+        std::size_t shard_capacity;
+        Hash hash;
+        std::vector<std::unique_ptr<shard_t>> shards;
+    };
+
+    std::shared_ptr<state> _state;
+
+    auto shard_of(Key const &key) const -> shard_t & {
+        return *_state->shards[_state->hash(key) % _state->shards.size()];
+    }
+
+  public:
+    memoized(UnaryFunction mapper, memoize_options options, Hash hash = Hash{})
+        : _state{std::make_shared<state>(state{std::move(mapper), options, 0, std::move(hash), {}})} {
+        auto const shards = std::max<std::size_t>(options.shards, 1);
+        _state->shard_capacity = std::max<std::size_t>((options.capacity + shards - 1) / shards, 1);
+        _state->shards.reserve(shards);
+        for (std::size_t i = 0; i < shards; ++i) {
+            _state->shards.push_back(std::make_unique<shard_t>());
+        }
+    }
+
+    /**
+     * Returns the cached result for key when it hasn't expired, or waits for a concurrent call computing it, or else
+     * computes it and caches it.
+     *
+     * When the function throws, nothing is cached, and the exception propagates to the calls waiting for it too.
+     */
+    auto operator()(Key const &key) const -> result_type {
+        auto &shard = shard_of(key);
+        auto found = shard.find(key, _state->options.policy);
+        if (found.cached) {
+            return *std::move(found.cached);
+        }
+        if (found.in_flight) {
+            return found.in_flight->get();
+        }
+        try {
+            auto result = result_type{detail::invoke(_state->mapper, key)};
+            shard.complete(key, result, _state->options, _state->shard_capacity);
+            found.promise->set_value(result);
+            return result;
+        } catch (...) {
+            shard.abandon(key);
+            found.promise->set_exception(std::current_exception());
+            throw;
+        }
+    }
+
+    /**
+     * @return the statistics of the cache, added up across its shards.
+     */
+    auto statistics() const -> memoize_statistics {
+        auto total = memoize_statistics{};
+        for (auto const &shard : _state->shards) {
+            auto const statistics = shard->statistics();
+            total.hits += statistics.hits;
+            total.shared += statistics.shared;
+            total.misses += statistics.misses;
+            total.evictions += statistics.evictions;
+        }
+        return total;
+    }
+
+    /**
+     * Drops every cached result, but keeps the statistics.
+     */
+    auto clear() const -> void {
+        for (auto const &shard : _state->shards) {
+            shard->clear();
+        }
+    }
+};
+
+/***
+ * Given an unary function f: Key -> N<B>, where N<B> is a nullable type (e.g. std::optional<B> or either<B, E>), it
+ * returns a new function Key -> N<B> that caches the results of f by key, including the empty ones unless configured
+ * otherwise, such that it may be passed to and_then, e.g. person >> memoize<person>(find_address).
+ *
+ * The cache is split into shards, each one with its own lock and its own entries, which are evicted according to the
+ * policy when the shard is full, and dropped once their time-to-live elapses. Concurrent calls with the same key
+ * share a single call to f.
+ *
+ * f must not call the memoized function with the same key, since it would wait for itself.
+ *
+ * @param mapper an unary function Key -> N<B>.
+ * @param options the capacity, the time-to-live, the eviction policy, and the sharding of the cache.
+ * @return a new function Key -> N<B> that caches the results of mapper.
+ */
+template <typename Key, typename Hash = std::hash<Key>, typename UnaryFunction>
+auto memoize(UnaryFunction &&mapper, memoize_options options = {}) -> memoized<Key, std::decay_t<UnaryFunction>, Hash> {
+    return memoized<Key, std::decay_t<UnaryFunction>, Hash>{std::forward<UnaryFunction>(mapper), options};
+}
+
+}
+
+#endif
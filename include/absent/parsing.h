@@ -0,0 +1,223 @@
+#ifndef RVARAGO_ABSENT_PARSING_H
+#define RVARAGO_ABSENT_PARSING_H
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::parsing {
+
+/**
+ * Why parsing failed.
+ */
+enum class error {
+    // The text doesn't start with a number.
+    invalid_number,
+
+    // The number doesn't fit in the requested type.
+    out_of_range,
+
+    // The text has characters left after the number, or fields left after the expected ones.
+    trailing_characters,
+
+    // The text has fewer fields than expected.
+    missing_field,
+
+    // The text doesn't have the separator between a key and a value.
+    missing_separator,
+};
+
+namespace detail {
+
+/***
+ * How the parsers wrap their results into std::optional, which discards the reason of a failure.
+ */
+struct optional_outcome final {
+    template <typename T>
+    using type = std::optional<T>;
+
+    template <typename T>
+    static constexpr auto success(T value) noexcept -> std::optional<T> {
+        return std::optional<T>{std::move(value)};
+    }
+
+    template <typename T>
+    static constexpr auto failure(error) noexcept -> std::optional<T> {
+        return std::nullopt;
+    }
+};
+
+template <typename Outcome, typename T>
+using outcome_t = typename Outcome::template type<T>;
+
+template <typename Outcome, typename T>
+auto to_outcome(std::string_view text, T const &value, std::from_chars_result const &result) noexcept
+    -> outcome_t<Outcome, T> {
+    if (result.ec == std::errc::invalid_argument) {
+        return Outcome::template failure<T>(error::invalid_number);
+    }
+    if (result.ec == std::errc::result_out_of_range) {
+        return Outcome::template failure<T>(error::out_of_range);
+    }
+    if (result.ptr != text.data() + text.size()) {
+        return Outcome::template failure<T>(error::trailing_characters);
+    }
+    return Outcome::success(value);
+}
+
+template <typename Outcome, typename T>
+auto parse_integer(std::string_view text, int base) noexcept -> outcome_t<Outcome, T> {
+    auto value = T{};
+    auto const result = std::from_chars(text.data(), text.data() + text.size(), value, base);
+    return to_outcome<Outcome>(text, value, result);
+}
+
+template <typename Outcome, typename T>
+auto parse_floating(std::string_view text, std::chars_format format) noexcept -> outcome_t<Outcome, T> {
+    auto value = T{};
+    auto const result = std::from_chars(text.data(), text.data() + text.size(), value, format);
+    return to_outcome<Outcome>(text, value, result);
+}
+
+template <typename Outcome>
+constexpr auto parse_field(std::string_view text, std::size_t index, char delimiter) noexcept
+    -> outcome_t<Outcome, std::string_view> {
+    for (; index > 0; --index) {
+        auto const end = text.find(delimiter);
+        if (end == std::string_view::npos) {
+            return Outcome::template failure<std::string_view>(error::missing_field);
+        }
+        text.remove_prefix(end + 1);
+    }
+    return Outcome::success(text.substr(0, text.find(delimiter)));
+}
+
+template <typename Outcome, std::size_t N>
+constexpr auto parse_fields(std::string_view text, char delimiter) noexcept
+    -> outcome_t<Outcome, std::array<std::string_view, N>> {
+    using Fields = std::array<std::string_view, N>;
+    auto fields = Fields{};
+    for (std::size_t i = 0; i + 1 < N; ++i) {
+        auto const end = text.find(delimiter);
+        if (end == std::string_view::npos) {
+            return Outcome::template failure<Fields>(error::missing_field);
+        }
+        fields[i] = text.substr(0, end);
+        text.remove_prefix(end + 1);
+    }
+    if (text.find(delimiter) != std::string_view::npos) {
+        return Outcome::template failure<Fields>(error::trailing_characters);
+    }
+    fields[N - 1] = text;
+    return Outcome::success(fields);
+}
+
+template <typename Outcome>
+constexpr auto parse_key_value(std::string_view text, char separator) noexcept
+    -> outcome_t<Outcome, std::pair<std::string_view, std::string_view>> {
+    using KeyValue = std::pair<std::string_view, std::string_view>;
+    auto const end = text.find(separator);
+    if (end == std::string_view::npos) {
+        return Outcome::template failure<KeyValue>(error::missing_separator);
+    }
+    return Outcome::success(KeyValue{text.substr(0, end), text.substr(end + 1)});
+}
+
+}
+
+/***
+ * Given a base, it returns a parser string_view -> optional<T> that parses the whole text as an integer of type T in
+ * such base, via std::from_chars, hence without allocating, throwing, nor depending on the locale.
+ *
+ * The parser returns an empty optional when the text isn't made only of an integer that fits in T. As std::from_chars,
+ * it accepts a leading minus sign for signed types only, and neither leading whitespaces, a leading plus sign, nor a
+ * base prefix such as 0x.
+ *
+ * @param base the base of the integer, between 2 and 36.
+ * @return a new parser string_view -> optional<T>.
+ */
+template <typename T>
+constexpr auto integer(int base = 10) noexcept {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "T must be an integral type other than bool");
+    return [base](std::string_view text) noexcept {
+        return detail::parse_integer<detail::optional_outcome, T>(text, base);
+    };
+}
+
+/***
+ * Given a format, it returns a parser string_view -> optional<T> that parses the whole text as a floating point number
+ * of type T in such format, via std::from_chars, hence without allocating, throwing, nor depending on the locale.
+ *
+ * The parser returns an empty optional when the text isn't made only of a number that fits in T.
+ *
+ * @param format the format of the number, by default either fixed or scientific.
+ * @return a new parser string_view -> optional<T>.
+ */
+template <typename T>
+constexpr auto floating(std::chars_format format = std::chars_format::general) noexcept {
+    static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+    return [format](std::string_view text) noexcept {
+        return detail::parse_floating<detail::optional_outcome, T>(text, format);
+    };
+}
+
+/***
+ * Given an index and a delimiter, it returns a parser string_view -> optional<string_view> that extracts the field at
+ * such index (starting from 0) of a text made of fields separated by the delimiter, e.g. "b" is the field at index 1
+ * of "a,b,c".
+ *
+ * The parser returns an empty optional when the text has fewer fields. The field refers into the text, which must
+ * therefore outlive it.
+ *
+ * @param index the index of the field.
+ * @param delimiter the character that separates the fields.
+ * @return a new parser string_view -> optional<string_view>.
+ */
+constexpr auto field(std::size_t index, char delimiter = ',') noexcept {
+    return [index, delimiter](std::string_view text) noexcept {
+        return detail::parse_field<detail::optional_outcome>(text, index, delimiter);
+    };
+}
+
+/***
+ * Given a delimiter, it returns a parser string_view -> optional<array<string_view, N>> that splits a text made of
+ * exactly N fields separated by the delimiter, e.g. a record.
+ *
+ * The parser returns an empty optional when the text has fewer or more than N fields. The fields refer into the text,
+ * which must therefore outlive them.
+ *
+ * @param delimiter the character that separates the fields.
+ * @return a new parser string_view -> optional<array<string_view, N>>.
+ */
+template <std::size_t N>
+constexpr auto fields(char delimiter = ',') noexcept {
+    static_assert(N > 0, "There must be at least one field");
+    return [delimiter](std::string_view text) noexcept {
+        return detail::parse_fields<detail::optional_outcome, N>(text, delimiter);
+    };
+}
+
+/***
+ * Given a separator, it returns a parser string_view -> optional<pair<string_view, string_view>> that splits a text
+ * into the key before the first separator and the value after it, e.g. "timeout" and "30" for "timeout=30".
+ *
+ * The parser returns an empty optional when the text doesn't have the separator. The key and the value refer into the
+ * text, which must therefore outlive them.
+ *
+ * @param separator the character that separates the key from the value.
+ * @return a new parser string_view -> optional<pair<string_view, string_view>>.
+ */
+constexpr auto key_value(char separator = '=') noexcept {
+    return [separator](std::string_view text) noexcept {
+        return detail::parse_key_value<detail::optional_outcome>(text, separator);
+    };
+}
+
+}
+
+#endif
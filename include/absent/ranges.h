@@ -0,0 +1,476 @@
+#ifndef RVARAGO_ABSENT_RANGES_H
+#define RVARAGO_ABSENT_RANGES_H
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#if defined(__cpp_lib_ranges)
+#include <ranges>
+#define RVARAGO_ABSENT_HAS_RANGES
+#endif
+
+#include "absent/support/invoke.h"
+#include "absent/zip.h"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent {
+
+namespace detail {
+
+template <typename T>
+using remove_cvref_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+#ifdef RVARAGO_ABSENT_HAS_RANGES
+
+template <typename Range>
+using all_t = std::views::all_t<Range>;
+
+template <typename Range>
+constexpr auto all(Range &&range) -> all_t<Range> {
+    return std::views::all(std::forward<Range>(range));
+}
+
+template <typename View>
+using view_base = std::ranges::view_interface<View>;
+
+template <typename Iterator>
+inline constexpr bool is_forward_iterator_v = std::forward_iterator<Iterator>;
+
+#else
+
+/***
+ * Refers to an lvalue range, which must outlive it, like std::ranges::ref_view.
+ */
+template <typename Range>
+class ref_range final {
+    Range *_range;
+
+  public:
+    constexpr explicit ref_range(Range &range) noexcept : _range{std::addressof(range)} {
+    }
+
+    constexpr auto begin() const -> decltype(std::begin(std::declval<Range &>())) {
+        return std::begin(*_range);
+    }
+
+    constexpr auto end() const -> decltype(std::end(std::declval<Range &>())) {
+        return std::end(*_range);
+    }
+};
+
+/***
+ * Lvalue ranges are referred to, whereas rvalue ranges are moved into the view that adapts them.
+ */
+template <typename Range>
+using all_t = std::conditional_t<std::is_lvalue_reference_v<Range>, ref_range<std::remove_reference_t<Range>>,
+                                 remove_cvref_t<Range>>;
+
+template <typename Range>
+constexpr auto all(Range &&range) -> all_t<Range> {
+    if constexpr (std::is_lvalue_reference_v<Range>) {
+        return ref_range<std::remove_reference_t<Range>>{range};
+    } else {
+        return std::move(range);
+    }
+}
+
+template <typename View>
+struct view_base {};
+
+template <typename Iterator>
+inline constexpr bool is_forward_iterator_v =
+    std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>;
+
+#endif
+
+template <typename Range>
+using iterator_t = decltype(std::begin(std::declval<Range &>()));
+
+template <typename Range>
+using sentinel_t = decltype(std::end(std::declval<Range &>()));
+
+/***
+ * Holds a function F, which may be a lambda, such that the views that hold it are assignable, like the exposition-only
+ * movable-box of the standard views.
+ */
+template <typename F>
+class box final {
+    std::optional<F> _f;
+
+  public:
+    constexpr explicit box(F f) : _f{std::in_place, std::move(f)} {
+    }
+
+    box(box const &) = default;
+    box(box &&) = default;
+
+    constexpr auto operator=(box const &other) -> box & {
+        if (this != &other) {
+            _f.reset();
+            if (other._f) {
+                _f.emplace(*other._f);
+            }
+        }
+        return *this;
+    }
+
+    constexpr auto operator=(box &&other) noexcept(std::is_nothrow_move_constructible_v<F>) -> box & {
+        if (this != &other) {
+            _f.reset();
+            if (other._f) {
+                _f.emplace(std::move(*other._f));
+            }
+        }
+        return *this;
+    }
+
+    constexpr auto operator*() const noexcept -> F const & {
+        return *_f;
+    }
+};
+
+/***
+ * An adaptor that, given a range, returns a view of it, and that is applied to a range with operator|.
+ */
+template <typename Adaptor>
+struct view_closure final {
+    Adaptor adaptor;
+
+    template <typename Range>
+    friend constexpr auto operator|(Range &&range, view_closure const &closure) {
+        return closure.adaptor(std::forward<Range>(range));
+    }
+};
+
+template <typename Adaptor>
+view_closure(Adaptor) -> view_closure<Adaptor>;
+
+struct is_present final {
+    template <typename Nullable>
+    constexpr auto operator()(Nullable const &n) const noexcept -> bool {
+        return fusion_of<Nullable>::has_value(n);
+    }
+};
+
+struct value_of_present final {
+    template <typename Nullable>
+    constexpr auto operator()(Nullable &&n) const noexcept -> decltype(*std::forward<Nullable>(n)) {
+        return *std::forward<Nullable>(n);
+    }
+};
+
+struct identity final {
+    template <typename A>
+    constexpr auto operator()(A &&a) const noexcept -> A && {
+        return std::forward<A>(a);
+    }
+};
+
+/***
+ * A view of the elements of View that satisfy Keep, each one of them accessed by Access and then mapped by F.
+ *
+ * Elements are accessed and mapped lazily, when the view is iterated, hence it doesn't allocate. When View yields
+ * elements by value rather than by reference, e.g. a std::views::transform, each kept element is computed twice: once
+ * to check it and once to access it, and and_then_each should be preferred.
+ */
+template <typename View, typename Keep, typename Access, typename F>
+class select_view final : public view_base<select_view<View, Keep, Access, F>> {
+    View _base;
+    box<F> _f;
+
+    using base_iterator = iterator_t<View>;
+    using base_sentinel = sentinel_t<View>;
+    using base_reference = decltype(*std::declval<base_iterator &>());
+    using mapped = decltype(detail::invoke(std::declval<F const &>(), Access{}(std::declval<base_reference>())));
+
+  public:
+    class sentinel;
+
+    class iterator final {
+        select_view *_parent = nullptr;
+        base_iterator _current{};
+
+        friend class select_view;
+
+        constexpr iterator(select_view &parent, base_iterator current) : _parent{&parent}, _current{current} {
+            satisfy();
+        }
+
+        constexpr auto satisfy() -> void {
+            auto const last = std::end(_parent->_base);
+            while (_current != last && !Keep{}(*_current)) {
+                ++_current;
+            }
+        }
+
+      public:
+        using reference = std::conditional_t<std::is_reference_v<base_reference>, mapped, remove_cvref_t<mapped>>;
+        using value_type = remove_cvref_t<reference>;
+        using difference_type = typename std::iterator_traits<base_iterator>::difference_type;
+        using pointer = void;
+        using iterator_category =
+            std::conditional_t<is_forward_iterator_v<base_iterator> && std::is_lvalue_reference_v<reference>,
+                               std::forward_iterator_tag, std::input_iterator_tag>;
+        using iterator_concept = std::conditional_t<is_forward_iterator_v<base_iterator>, std::forward_iterator_tag,
+                                                    std::input_iterator_tag>;
+
+        iterator() = default;
+
+        constexpr auto base() const -> base_iterator {
+            return _current;
+        }
+
+        constexpr auto operator*() const -> reference {
+            return detail::invoke(*_parent->_f, Access{}(*_current));
+        }
+
+        constexpr auto operator++() -> iterator & {
+            ++_current;
+            satisfy();
+            return *this;
+        }
+
+        constexpr auto operator++(int) -> iterator {
+            auto previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        friend constexpr auto operator==(iterator const &lhs, iterator const &rhs) -> bool {
+            return lhs._current == rhs._current;
+        }
+
+        friend constexpr auto operator!=(iterator const &lhs, iterator const &rhs) -> bool {
+            return !(lhs == rhs);
+        }
+
+        friend constexpr auto operator==(iterator const &lhs, sentinel const &rhs) -> bool {
+            return lhs._current == rhs.base();
+        }
+
+        friend constexpr auto operator!=(iterator const &lhs, sentinel const &rhs) -> bool {
+            return !(lhs == rhs);
+        }
+
+        friend constexpr auto operator==(sentinel const &lhs, iterator const &rhs) -> bool {
+            return rhs == lhs;
+        }
+
+        friend constexpr auto operator!=(sentinel const &lhs, iterator const &rhs) -> bool {
+            return !(rhs == lhs);
+        }
+    };
+
+    class sentinel final {
+        base_sentinel _last{};
+
+        friend class select_view;
+
+        constexpr explicit sentinel(base_sentinel last) : _last{last} {
+        }
+
+      public:
+        sentinel() = default;
+
+        constexpr auto base() const -> base_sentinel {
+            return _last;
+        }
+    };
+
+    constexpr select_view(View base, F f) : _base{std::move(base)}, _f{std::move(f)} {
+    }
+
+    constexpr auto begin() -> iterator {
+        return iterator{*this, std::begin(_base)};
+    }
+
+    constexpr auto end() -> sentinel {
+        return sentinel{std::end(_base)};
+    }
+};
+
+/***
+ * A view of the values wrapped inside the non-empty nullables returned by F for each element of View.
+ *
+ * F is called exactly once per element, and its current result is cached in the iterator, which is therefore an input
+ * iterator.
+ */
+template <typename View, typename F>
+class bind_view final : public view_base<bind_view<View, F>> {
+    View _base;
+    box<F> _f;
+
+    using base_iterator = iterator_t<View>;
+    using base_sentinel = sentinel_t<View>;
+    using result =
+        remove_cvref_t<decltype(detail::invoke(std::declval<F const &>(), *std::declval<base_iterator &>()))>;
+
+  public:
+    class sentinel;
+
+    class iterator final {
+        bind_view *_parent = nullptr;
+        base_iterator _current{};
+        mutable std::optional<result> _result;
+
+        friend class bind_view;
+
+        constexpr iterator(bind_view &parent, base_iterator current) : _parent{&parent}, _current{current} {
+            satisfy();
+        }
+
+        constexpr auto satisfy() -> void {
+            auto const last = std::end(_parent->_base);
+            for (; _current != last; ++_current) {
+                _result.emplace(detail::invoke(*_parent->_f, *_current));
+                if (fusion_of<result>::has_value(*_result)) {
+                    return;
+                }
+            }
+            _result.reset();
+        }
+
+      public:
+        using reference = decltype(**std::declval<std::optional<result> &>());
+        using value_type = remove_cvref_t<reference>;
+        using difference_type = typename std::iterator_traits<base_iterator>::difference_type;
+        using pointer = void;
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::input_iterator_tag;
+
+        iterator() = default;
+
+        constexpr auto base() const -> base_iterator {
+            return _current;
+        }
+
+        constexpr auto operator*() const -> reference {
+            return **_result;
+        }
+
+        constexpr auto operator++() -> iterator & {
+            ++_current;
+            satisfy();
+            return *this;
+        }
+
+        constexpr auto operator++(int) -> void {
+            ++*this;
+        }
+
+        friend constexpr auto operator==(iterator const &lhs, sentinel const &rhs) -> bool {
+            return lhs._current == rhs.base();
+        }
+
+        friend constexpr auto operator!=(iterator const &lhs, sentinel const &rhs) -> bool {
+            return !(lhs == rhs);
+        }
+
+        friend constexpr auto operator==(sentinel const &lhs, iterator const &rhs) -> bool {
+            return rhs == lhs;
+        }
+
+        friend constexpr auto operator!=(sentinel const &lhs, iterator const &rhs) -> bool {
+            return !(rhs == lhs);
+        }
+    };
+
+    class sentinel final {
+        base_sentinel _last{};
+
+        friend class bind_view;
+
+        constexpr explicit sentinel(base_sentinel last) : _last{last} {
+        }
+
+      public:
+        sentinel() = default;
+
+        constexpr auto base() const -> base_sentinel {
+            return _last;
+        }
+    };
+
+    constexpr bind_view(View base, F f) : _base{std::move(base)}, _f{std::move(f)} {
+    }
+
+    constexpr auto begin() -> iterator {
+        return iterator{*this, std::begin(_base)};
+    }
+
+    constexpr auto end() -> sentinel {
+        return sentinel{std::end(_base)};
+    }
+};
+
+template <typename Keep, typename Access, typename F>
+constexpr auto select(F &&f) {
+    return view_closure{[f = std::forward<F>(f)](auto &&range) {
+        using Range = decltype(range);
+        return select_view<all_t<Range>, Keep, Access, std::decay_t<F>>{all(std::forward<Range>(range)), f};
+    }};
+}
+
+}
+
+namespace views {
+
+/***
+ * Given a range of nullables N<A> (i.e. optional-like objects), it returns a lazy view of the values of type A wrapped
+ * inside the non-empty ones, skipping the empty ones, e.g. for (auto const &a : nullables | present()).
+ *
+ * Nothing is copied nor allocated: the view refers to the values inside the range, which must outlive it unless it's
+ * an rvalue, and its iterators skip the empty nullables as they advance. It composes with the standard views when
+ * they are available.
+ *
+ * @return an adaptor that given a range of nullables N<A>, returns a view of As.
+ */
+constexpr auto present() noexcept {
+    return detail::select<detail::is_present, detail::value_of_present>(detail::identity{});
+}
+
+/***
+ * Given an unary function f: A -> B, it returns an adaptor that, given a range of nullables N<A> (i.e. optional-like
+ * objects), returns a lazy view of the results of f applied to the values wrapped inside the non-empty ones.
+ *
+ * It's equivalent to present() followed by a transform view, where f is only called when an element is accessed.
+ *
+ * @param mapper an unary function A -> B.
+ * @return an adaptor that given a range of nullables N<A>, returns a view of Bs.
+ */
+template <typename UnaryFunction>
+constexpr auto transform_present(UnaryFunction &&mapper) {
+    return detail::select<detail::is_present, detail::value_of_present>(std::forward<UnaryFunction>(mapper));
+}
+
+/***
+ * Given an unary function f: A -> N<B>, where N is a nullable type (i.e. optional-like object), it returns an adaptor
+ * that, given a range of As, returns a lazy view of the values of type B wrapped inside the non-empty nullables
+ * returned by f, skipping the empty ones.
+ *
+ * f is called exactly once per element, as the view is iterated, which makes it an input view.
+ *
+ * @param mapper an unary function A -> N<B>.
+ * @return an adaptor that given a range of As, returns a view of Bs.
+ */
+template <typename UnaryFunction>
+constexpr auto and_then_each(UnaryFunction &&mapper) {
+    return detail::view_closure{[mapper = std::forward<UnaryFunction>(mapper)](auto &&range) {
+        using Range = decltype(range);
+        return detail::bind_view<detail::all_t<Range>, std::decay_t<UnaryFunction>>{
+            detail::all(std::forward<Range>(range)), mapper};
+    }};
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_ALLOCATOR_H
+#define RVARAGO_ABSENT_SUPPORT_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::detail {
+
+/***
+ * Constructs a T from args by uses-allocator construction, i.e. passing it allocator in whichever way it accepts one,
+ * if any, as std::make_obj_using_allocator does in C++20.
+ */
+template <typename T, typename Allocator, typename... Args>
+constexpr auto make_using_allocator(Allocator const &allocator, Args &&... args) -> T {
+    if constexpr (!std::uses_allocator_v<T, Allocator>) {
+        return T(std::forward<Args>(args)...);
+    } else if constexpr (std::is_constructible_v<T, std::allocator_arg_t, Allocator const &, Args &&...>) {
+        return T(std::allocator_arg, allocator, std::forward<Args>(args)...);
+    } else {
+        static_assert(std::is_constructible_v<T, Args &&..., Allocator const &>,
+                      "T uses the allocator, but it can't be constructed with it");
+        return T(std::forward<Args>(args)..., allocator);
+    }
+}
+
+template <typename T, typename = void>
+inline constexpr bool is_allocator_v = false;
+
+template <typename T>
+inline constexpr bool is_allocator_v<
+    T, std::void_t<typename T::value_type, decltype(std::declval<T &>().allocate(std::size_t{}))>> = true;
+
+template <typename T, typename = void>
+inline constexpr bool has_allocator_v = false;
+
+template <typename T>
+inline constexpr bool has_allocator_v<T, std::void_t<decltype(std::declval<T const &>().get_allocator())>> =
+    std::uses_allocator_v<T, decltype(std::declval<T const &>().get_allocator())>;
+
+/***
+ * Copies value, such that when it's allocator-aware, the copy uses the same allocator rather than the one selected by
+ * its copy constructor, e.g. a std::pmr::string copied out of an arena stays in that arena instead of moving to the
+ * default memory resource.
+ */
+template <typename T>
+constexpr auto copy_with_allocator(T const &value) -> T {
+    if constexpr (has_allocator_v<T>) {
+        return make_using_allocator<T>(value.get_allocator(), value);
+    } else {
+        return value;
+    }
+}
+
+}
+
+#endif
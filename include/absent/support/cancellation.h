@@ -0,0 +1,53 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_CANCELLATION_H
+#define RVARAGO_ABSENT_SUPPORT_CANCELLATION_H
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace rvarago::absent::support {
+
+/**
+ * Observes whether a cancellation has been requested by the corresponding cancellation_source.
+ *
+ * Cancellation is cooperative: a computation holding a token should poll is_cancelled() and stop early when it returns
+ * true.
+ */
+class cancellation_token final {
+    std::shared_ptr<std::atomic<bool>> _is_cancelled;
+
+    friend class cancellation_source;
+
+    explicit cancellation_token(std::shared_ptr<std::atomic<bool>> is_cancelled) noexcept
+        : _is_cancelled{std::move(is_cancelled)} {
+    }
+
+  public:
+    auto is_cancelled() const noexcept -> bool {
+        return _is_cancelled->load(std::memory_order_relaxed);
+    }
+};
+
+/**
+ * Requests the cancellation of the computations holding its tokens.
+ */
+class cancellation_source final {
+    std::shared_ptr<std::atomic<bool>> _is_cancelled = std::make_shared<std::atomic<bool>>(false);
+
+  public:
+    auto token() const noexcept -> cancellation_token {
+        return cancellation_token{_is_cancelled};
+    }
+
+    auto cancel() const noexcept -> void {
+        _is_cancelled->store(true, std::memory_order_relaxed);
+    }
+
+    auto is_cancelled() const noexcept -> bool {
+        return _is_cancelled->load(std::memory_order_relaxed);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,292 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_COMPACTOPTIONAL_H
+#define RVARAGO_ABSENT_SUPPORT_COMPACTOPTIONAL_H
+
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::support {
+
+/**
+ * Describes the reserved value of type T that a compact_optional<T> uses to represent emptiness.
+ *
+ * Specialisations must provide:
+ * - empty(): the reserved value.
+ * - is_empty(value): whether value is the reserved value.
+ *
+ * A reserved value must never be a legitimate value, otherwise the result of a combinator that happens to be equal to
+ * it would silently become empty. Hence, it's opt-in: besides pointers, there are no specialisations for arithmetic
+ * types, where every value may be legitimate. Rather, they may be wrapped in reserved, reserved_max, or reserved_nan,
+ * and a dedicated type (e.g. a row index whose maximum is never used) may reserve one of its values by specialising it.
+ *
+ * Types without a specialisation have no reserved value, and a compact_optional of them keeps a separate flag instead.
+ */
+template <typename T, typename = void>
+struct sentinel_traits {};
+
+/**
+ * Pointers reserve nullptr.
+ */
+template <typename T>
+struct sentinel_traits<T *> {
+    static constexpr auto empty() noexcept -> T * {
+        return nullptr;
+    }
+
+    static constexpr auto is_empty(T *value) noexcept -> bool {
+        return value == nullptr;
+    }
+};
+
+/**
+ * An integral value of type T that reserves Reserved to represent emptiness, e.g. compact_optional<reserved<int, -1>>
+ * for a non-negative int, which is as large as an int.
+ *
+ * It converts implicitly from and to T, such that functions of T may be called with it, although a function whose
+ * result should also be compact must return it rather than T.
+ */
+template <typename T, T Reserved>
+class reserved final {
+    static_assert(std::is_integral_v<T>, "Type T must be integral, see reserved_nan for floating-point types");
+
+    T _value{};
+
+  public:
+    constexpr reserved() noexcept = default;
+
+    constexpr reserved(T value) noexcept : _value{value} {
+    }
+
+    constexpr operator T() const noexcept {
+        return _value;
+    }
+};
+
+/**
+ * An integral value of type T that reserves its maximum, e.g. an index that never reaches it.
+ */
+template <typename T>
+using reserved_max = reserved<T, std::numeric_limits<T>::max()>;
+
+/**
+ * A floating-point value of type T that reserves NaN, thus any NaN is considered empty.
+ */
+template <typename T>
+class reserved_nan final {
+    static_assert(std::is_floating_point_v<T>, "Type T must be a floating-point type");
+
+    T _value{};
+
+  public:
+    constexpr reserved_nan() noexcept = default;
+
+    constexpr reserved_nan(T value) noexcept : _value{value} {
+    }
+
+    constexpr operator T() const noexcept {
+        return _value;
+    }
+};
+
+template <typename T, T Reserved>
+struct sentinel_traits<reserved<T, Reserved>> {
+    static constexpr auto empty() noexcept -> reserved<T, Reserved> {
+        return Reserved;
+    }
+
+    static constexpr auto is_empty(reserved<T, Reserved> value) noexcept -> bool {
+        return static_cast<T>(value) == Reserved;
+    }
+};
+
+template <typename T>
+struct sentinel_traits<reserved_nan<T>> {
+    static constexpr auto empty() noexcept -> reserved_nan<T> {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+
+    static constexpr auto is_empty(reserved_nan<T> value) noexcept -> bool {
+        return static_cast<T>(value) != static_cast<T>(value);
+    }
+};
+
+namespace detail {
+
+template <typename T, typename = void>
+inline constexpr bool has_sentinel_v = false;
+
+template <typename T>
+inline constexpr bool has_sentinel_v<T, std::void_t<decltype(sentinel_traits<T>::empty())>> = true;
+
+/**
+ * Storage of a compact_optional<T> when T has a reserved value, which takes no more space than T itself.
+ */
+template <typename T, bool = has_sentinel_v<T>>
+struct compact_storage {
+    T _value;
+
+    constexpr compact_storage() noexcept : _value(sentinel_traits<T>::empty()) {
+    }
+
+    template <typename... Args>
+    constexpr explicit compact_storage(std::in_place_t, Args &&... args) : _value(std::forward<Args>(args)...) {
+    }
+
+    constexpr auto has_value() const noexcept -> bool {
+        return !sentinel_traits<T>::is_empty(_value);
+    }
+
+    constexpr auto get() const noexcept -> T const * {
+        return std::addressof(_value);
+    }
+
+    constexpr auto get() noexcept -> T * {
+        return std::addressof(_value);
+    }
+
+    constexpr auto reset() noexcept -> void {
+        _value = sentinel_traits<T>::empty();
+    }
+};
+
+/**
+ * Storage of a compact_optional<T> when T has no reserved value, which falls back to a separate flag.
+ */
+template <typename T>
+struct compact_storage<T, false> {
+    std::optional<T> _value;
+
+    constexpr compact_storage() noexcept = default;
+
+    template <typename... Args>
+    constexpr explicit compact_storage(std::in_place_t, Args &&... args)
+        : _value(std::in_place, std::forward<Args>(args)...) {
+    }
+
+    constexpr auto has_value() const noexcept -> bool {
+        return _value.has_value();
+    }
+
+    constexpr auto get() const noexcept -> T const * {
+        return std::addressof(*_value);
+    }
+
+    constexpr auto get() noexcept -> T * {
+        return std::addressof(*_value);
+    }
+
+    constexpr auto reset() noexcept -> void {
+        _value.reset();
+    }
+};
+
+}
+
+/**
+ * An optional-like type that, when T has a reserved value described by sentinel_traits<T>, represents emptiness by
+ * storing that value rather than a separate flag, hence sizeof(compact_optional<T>) == sizeof(T).
+ *
+ * Thus, a compact_optional<T> constructed from the reserved value is empty, e.g. compact_optional<int *>{nullptr}.
+ */
+template <typename T>
+class compact_optional final : private detail::compact_storage<T> {
+    using base = detail::compact_storage<T>;
+
+    template <typename U>
+    static constexpr bool is_constructible_from_v =
+        std::is_constructible_v<T, U &&> &&
+        !std::is_same_v<std::remove_cv_t<std::remove_reference_t<U>>, compact_optional> &&
+        !std::is_same_v<std::remove_cv_t<std::remove_reference_t<U>>, std::nullopt_t> &&
+        !std::is_same_v<std::remove_cv_t<std::remove_reference_t<U>>, std::in_place_t>;
+
+  public:
+    using value_type = T;
+
+    /**
+     * Creates an empty compact_optional.
+     */
+    constexpr compact_optional() noexcept = default;
+
+    constexpr compact_optional(std::nullopt_t) noexcept : base{} {
+    }
+
+    /**
+     * Creates a compact_optional holding a value of type T constructed from value, which is implicit only when value
+     * converts implicitly to T, hence e.g. an int doesn't become a compact_optional<std::vector<int>> by accident.
+     */
+    template <typename U = T,
+              std::enable_if_t<is_constructible_from_v<U> && std::is_convertible_v<U &&, T>, int> = 0>
+    constexpr compact_optional(U &&value) noexcept(std::is_nothrow_constructible_v<T, U &&>)
+        : base{std::in_place, std::forward<U>(value)} {
+    }
+
+    template <typename U = T,
+              std::enable_if_t<is_constructible_from_v<U> && !std::is_convertible_v<U &&, T>, int> = 0>
+    constexpr explicit compact_optional(U &&value) noexcept(std::is_nothrow_constructible_v<T, U &&>)
+        : base{std::in_place, std::forward<U>(value)} {
+    }
+
+    template <typename... Args>
+    constexpr explicit compact_optional(std::in_place_t, Args &&... args) noexcept(
+        std::is_nothrow_constructible_v<T, Args &&...>)
+        : base{std::in_place, std::forward<Args>(args)...} {
+    }
+
+    /**
+     * @return whether it holds a value of type T.
+     */
+    constexpr auto has_value() const noexcept -> bool {
+        return base::has_value();
+    }
+
+    constexpr explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    /**
+     * Unchecked access to the value of type T, which must be held.
+     */
+    constexpr auto operator*() const &noexcept -> T const & {
+        return *base::get();
+    }
+
+    constexpr auto operator*() &noexcept -> T & {
+        return *base::get();
+    }
+
+    constexpr auto operator*() &&noexcept -> T && {
+        return std::move(*base::get());
+    }
+
+    constexpr auto operator->() const noexcept -> T const * {
+        return base::get();
+    }
+
+    constexpr auto operator->() noexcept -> T * {
+        return base::get();
+    }
+
+    /**
+     * Makes it empty.
+     */
+    constexpr auto reset() noexcept -> void {
+        base::reset();
+    }
+
+    friend constexpr auto operator==(compact_optional const &lhs, compact_optional const &rhs) -> bool {
+        if (lhs.has_value() != rhs.has_value()) {
+            return false;
+        }
+        return !lhs.has_value() || *lhs == *rhs;
+    }
+
+    friend constexpr auto operator!=(compact_optional const &lhs, compact_optional const &rhs) -> bool {
+        return !(lhs == rhs);
+    }
+};
+
+}
+
+#endif
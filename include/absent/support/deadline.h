@@ -0,0 +1,124 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_DEADLINE_H
+#define RVARAGO_ABSENT_SUPPORT_DEADLINE_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <time.h>
+#endif
+
+namespace rvarago::absent::support {
+
+/**
+ * The error of a stage that was skipped because its deadline had already expired.
+ */
+struct deadline_exceeded final {};
+
+constexpr bool operator==(deadline_exceeded, deadline_exceeded) noexcept {
+    return true;
+}
+
+constexpr bool operator!=(deadline_exceeded, deadline_exceeded) noexcept {
+    return false;
+}
+
+/**
+ * A monotonic clock that trades precision, typically a few milliseconds, for cheaper reads, since on Linux it's read
+ * from a timestamp updated by the kernel on every tick (CLOCK_MONOTONIC_COARSE), or else from steady_clock.
+ */
+struct coarse_steady_clock final {
+    using duration = std::chrono::nanoseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<coarse_steady_clock>;
+
+    static constexpr bool is_steady = true;
+
+    static auto now() noexcept -> time_point {
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+        auto spec = timespec{};
+        clock_gettime(CLOCK_MONOTONIC_COARSE, &spec);
+        return time_point{std::chrono::seconds{spec.tv_sec} + std::chrono::nanoseconds{spec.tv_nsec}};
+#else
+        return time_point{std::chrono::duration_cast<duration>(std::chrono::steady_clock::now().time_since_epoch())};
+#endif
+    }
+};
+
+/**
+ * The point in time, according to Clock, by which a pipeline must be done, e.g. the latency budget of a request.
+ *
+ * To keep the checks off the hot path, it only reads Clock once every read_every calls to expired(), and it
+ * answers from the last reading otherwise, hence a stage may still run up to read_every - 1 checks after the deadline.
+ * Once expired, it stays expired without reading Clock again.
+ *
+ * It's meant to be checked by the stages of a single pipeline at a time, hence it's not safe to share across threads.
+ */
+template <typename Clock>
+class basic_deadline final {
+  public:
+    using clock = Clock;
+    using duration = typename Clock::duration;
+    using time_point = typename Clock::time_point;
+
+  private:
+    time_point _expires_at;
+    mutable time_point _now;
+    std::uint32_t _read_every;
+    mutable std::uint32_t _until_read;
+    mutable bool _is_expired;
+
+    auto read() const noexcept -> void {
+        _now = Clock::now();
+        _until_read = _read_every;
+        _is_expired = _now >= _expires_at;
+    }
+
+  public:
+    /**
+     * Creates a deadline that expires at expires_at, and that reads Clock once every read_every checks.
+     */
+    explicit basic_deadline(time_point expires_at, std::uint32_t read_every = 1) noexcept
+        : _expires_at{expires_at}, _now{}, _read_every{std::max<std::uint32_t>(read_every, 1)}, _until_read{0},
+          _is_expired{false} {
+        read();
+    }
+
+    /**
+     * Creates a deadline that expires once budget has elapsed from now.
+     */
+    static auto after(duration budget, std::uint32_t read_every = 1) noexcept -> basic_deadline {
+        return basic_deadline{Clock::now() + budget, read_every};
+    }
+
+    /**
+     * @return whether the deadline has expired, reading Clock only once every read_every calls.
+     */
+    auto expired() const noexcept -> bool {
+        if (!_is_expired && --_until_read == 0) {
+            read();
+        }
+        return _is_expired;
+    }
+
+    /**
+     * @return the budget left as of the last reading of Clock, or zero once expired.
+     */
+    auto remaining() const noexcept -> duration {
+        return _is_expired ? duration::zero() : std::max(_expires_at - _now, duration::zero());
+    }
+
+    auto expires_at() const noexcept -> time_point {
+        return _expires_at;
+    }
+};
+
+using deadline = basic_deadline<std::chrono::steady_clock>;
+
+using coarse_deadline = basic_deadline<coarse_steady_clock>;
+
+}
+
+#endif
@@ -1,23 +1,92 @@
 #ifndef RVARAGO_ABSENT_SUPPORT_FROMVARIANT_H
 #define RVARAGO_ABSENT_SUPPORT_FROMVARIANT_H
 
+#include "absent/support/optional_ref.h"
+
+#include <array>
+#include <cstddef>
 #include <optional>
 #include <type_traits>
+#include <utility>
 #include <variant>
 
 namespace rvarago::absent {
 
+namespace detail {
+
+template <typename A, typename... Rest>
+inline constexpr bool is_alternative_v = std::disjunction_v<std::is_same<A, Rest>...>;
+
+/***
+ * The index of A among As, or sizeof...(As) when A isn't among them.
+ */
+template <typename A, typename... As>
+constexpr auto index_among() noexcept -> std::size_t {
+    constexpr auto matches = std::array<bool, sizeof...(As) + 1>{std::is_same_v<A, As>..., true};
+    std::size_t index = 0;
+    while (!matches[index]) {
+        ++index;
+    }
+    return index;
+}
+
+template <typename Result, typename Variant, typename Indices>
+struct projection;
+
+/***
+ * Projects a Variant, i.e. a possibly const reference to a variant<Rest...>, or an rvalue one, into an
+ * optional<variant<As...>>, by comparing the index of the alternative it holds with the indices of the requested
+ * alternatives only, as a single fold that the compiler may turn into a jump table, rather than visiting every
+ * alternative.
+ */
+template <typename... As, typename Variant, std::size_t... Is>
+struct projection<std::optional<std::variant<As...>>, Variant, std::index_sequence<Is...>> final {
+    using Result = std::optional<std::variant<As...>>;
+
+    template <std::size_t I>
+    static constexpr auto target =
+        index_among<std::variant_alternative_t<I, std::remove_cv_t<std::remove_reference_t<Variant>>>, As...>();
+
+    template <std::size_t I>
+    static constexpr auto project(Variant &&v, Result &result) -> bool {
+        if constexpr (target<I> == sizeof...(As)) {
+            return false;
+        } else {
+            if (v.index() != I) {
+                return false;
+            }
+            if constexpr (std::is_reference_v<Variant>) {
+                result.emplace(std::in_place_index<target<I>>, *std::get_if<I>(&v));
+            } else {
+                result.emplace(std::in_place_index<target<I>>, std::move(*std::get_if<I>(&v)));
+            }
+            return true;
+        }
+    }
+
+    static constexpr auto dispatch(Variant &&v) -> Result {
+        auto result = Result{};
+        (project<Is>(std::forward<Variant>(v), result) || ...);
+        return result;
+    }
+};
+
+}
+
 /***
  * Given a nullable type N<A> (i.e. optional like object), and a variant<As....>
  * - When A is the same held by the variant: it should return a nullable N<A> wrapping the corresponding value.
  * - When *not*: it should return a new empty nullable N<A>.
  *
+ * Only the value of type A is copied, and only when the variant holds it.
+ *
  * @param input an std::variant.
  * @return a new nullable containing the value wrapped by the variant, possibly empty.
  */
 template <typename A, template <typename> typename Nullable = std::optional, typename... Rest>
-constexpr auto from_variant(std::variant<Rest...> v) noexcept -> Nullable<A> {
-    static_assert(std::disjunction_v<std::is_same<A, Rest>...>, "Type A is not a member type of the variant");
+constexpr auto from_variant(std::variant<Rest...> const &v) noexcept(std::is_nothrow_copy_constructible_v<A>)
+    -> Nullable<A> {
+    static_assert(detail::is_alternative_v<A, Rest...>, "Type A is not a member type of the variant");
 
     if (auto const value = std::get_if<A>(&v); value) {
         return Nullable<A>{*value};
@@ -26,6 +95,97 @@ constexpr auto from_variant(std::variant<Rest...> v) noexcept -> Nullable<A> {
     }
 }
 
+/***
+ * Overload of from_variant for an rvalue variant<As...>, whose value of type A is moved into the new nullable N<A>.
+ */
+template <typename A, template <typename> typename Nullable = std::optional, typename... Rest>
+constexpr auto from_variant(std::variant<Rest...> &&v) noexcept(std::is_nothrow_move_constructible_v<A>)
+    -> Nullable<A> {
+    static_assert(detail::is_alternative_v<A, Rest...>, "Type A is not a member type of the variant");
+
+    if (auto const value = std::get_if<A>(&v); value) {
+        return Nullable<A>{std::move(*value)};
+    } else {
+        return Nullable<A>{};
+    }
+}
+
+/***
+ * Same as from_variant, but it returns a non-owning optional_ref<A> referring to the value of type A held by the
+ * variant, hence nothing is copied. The result must not outlive the variant, nor the variant change its alternative
+ * while the result is in use.
+ *
+ * @param input an std::variant, whose value of type A may be modified via the result when it's not const.
+ * @return a new optional_ref referring to the value wrapped by the variant, possibly empty.
+ */
+template <typename A, typename... Rest>
+constexpr auto from_variant_ref(std::variant<Rest...> &v) noexcept -> support::optional_ref<A> {
+    static_assert(detail::is_alternative_v<A, Rest...>, "Type A is not a member type of the variant");
+
+    if (auto const value = std::get_if<A>(&v); value) {
+        return support::optional_ref<A>{*value};
+    } else {
+        return support::optional_ref<A>{};
+    }
+}
+
+/***
+ * Overload of from_variant_ref for a const variant<As...>, which returns an optional_ref<A const>.
+ */
+template <typename A, typename... Rest>
+constexpr auto from_variant_ref(std::variant<Rest...> const &v) noexcept -> support::optional_ref<A const> {
+    static_assert(detail::is_alternative_v<A, Rest...>, "Type A is not a member type of the variant");
+
+    if (auto const value = std::get_if<A>(&v); value) {
+        return support::optional_ref<A const>{*value};
+    } else {
+        return support::optional_ref<A const>{};
+    }
+}
+
+/***
+ * An rvalue variant<As...> is rejected by from_variant_ref, since the result would refer into a temporary.
+ */
+template <typename A, typename... Rest>
+auto from_variant_ref(std::variant<Rest...> &&v) = delete;
+
+/***
+ * Given a variant<Rest...> and some of its alternative types As...:
+ * - When the variant holds any of As...: it should return an optional<variant<As...>> wrapping the corresponding
+ * value.
+ * - When *not*: it should return a new empty optional<variant<As...>>.
+ *
+ * It replaces a sequence of from_variant<A1>, ..., from_variant<An>, by dispatching once on the index of the
+ * alternative held by the variant, rather than checking each one of As... in turn, and only the selected value is
+ * copied.
+ *
+ * @param input an std::variant.
+ * @return a new optional containing the narrower variant, possibly empty.
+ */
+template <typename... As, typename... Rest>
+constexpr auto project_variant(std::variant<Rest...> const &v) -> std::optional<std::variant<As...>> {
+    static_assert(sizeof...(As) > 0, "There must be at least one alternative to project");
+    static_assert((detail::is_alternative_v<As, Rest...> && ...), "Every type As must be a member type of the variant");
+
+    using Projection = detail::projection<std::optional<std::variant<As...>>, std::variant<Rest...> const &,
+                                          std::index_sequence_for<Rest...>>;
+    return Projection::dispatch(v);
+}
+
+/***
+ * Overload of project_variant for an rvalue variant<Rest...>, whose selected value is moved into the new
+ * optional<variant<As...>>.
+ */
+template <typename... As, typename... Rest>
+constexpr auto project_variant(std::variant<Rest...> &&v) -> std::optional<std::variant<As...>> {
+    static_assert(sizeof...(As) > 0, "There must be at least one alternative to project");
+    static_assert((detail::is_alternative_v<As, Rest...> && ...), "Every type As must be a member type of the variant");
+
+    using Projection =
+        detail::projection<std::optional<std::variant<As...>>, std::variant<Rest...>, std::index_sequence_for<Rest...>>;
+    return Projection::dispatch(std::move(v));
+}
+
 }
 
 #endif
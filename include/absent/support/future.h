@@ -0,0 +1,245 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_FUTURE_H
+#define RVARAGO_ABSENT_SUPPORT_FUTURE_H
+
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::support {
+
+namespace detail {
+
+/**
+ * A type-erased nullary callable that, unlike std::function, may own move-only state.
+ */
+class unique_task final {
+    struct callable {
+        virtual ~callable() = default;
+        virtual auto operator()() -> void = 0;
+    };
+
+    template <typename NullaryFunction>
+    struct model final : callable {
+        NullaryFunction f;
+
+        explicit model(NullaryFunction &&f) : f{std::move(f)} {
+        }
+
+        auto operator()() -> void override {
+            f();
+        }
+    };
+
+    std::unique_ptr<callable> _callable;
+
+  public:
+    unique_task() = default;
+
+    template <typename NullaryFunction,
+              std::enable_if_t<!std::is_same_v<std::decay_t<NullaryFunction>, unique_task>, int> = 0>
+    unique_task(NullaryFunction &&f)
+        : _callable{std::make_unique<model<std::decay_t<NullaryFunction>>>(std::forward<NullaryFunction>(f))} {
+    }
+
+    explicit operator bool() const noexcept {
+        return static_cast<bool>(_callable);
+    }
+
+    auto operator()() -> void {
+        (*_callable)();
+    }
+};
+
+/**
+ * State shared between a promise<T> and its future<T>.
+ */
+template <typename T>
+struct shared_state final {
+    std::mutex mutex;
+    std::condition_variable ready_condition;
+    std::optional<T> value;
+    std::exception_ptr exception;
+    unique_task continuation;
+    bool is_ready = false;
+
+    template <typename Complete>
+    auto complete(Complete &&store) -> void {
+        auto continuation_to_run = unique_task{};
+        {
+            auto const lock = std::lock_guard{mutex};
+            if (is_ready) {
+                throw std::logic_error{"The promise has already been satisfied"};
+            }
+            std::forward<Complete>(store)();
+            is_ready = true;
+            continuation_to_run = std::move(continuation);
+        }
+        ready_condition.notify_all();
+        if (continuation_to_run) {
+            continuation_to_run();
+        }
+    }
+
+    auto subscribe(unique_task &&f) -> void {
+        {
+            auto const lock = std::lock_guard{mutex};
+            if (!is_ready) {
+                continuation = std::move(f);
+                return;
+            }
+        }
+        f();
+    }
+
+    auto is_satisfied() -> bool {
+        auto const lock = std::lock_guard{mutex};
+        return is_ready;
+    }
+
+    auto wait() -> void {
+        auto lock = std::unique_lock{mutex};
+        ready_condition.wait(lock, [this] { return is_ready; });
+    }
+};
+
+}
+
+template <typename T>
+class promise;
+
+/**
+ * Holds a value of type T that becomes available asynchronously, once the corresponding promise<T> is satisfied.
+ *
+ * Like std::future<T>, its value can be obtained only once, either by get() or by a continuation registered by
+ * subscribe(), which doesn't block any thread while waiting.
+ */
+template <typename T>
+class future final {
+    std::shared_ptr<detail::shared_state<T>> _state;
+
+    friend class promise<T>;
+
+    explicit future(std::shared_ptr<detail::shared_state<T>> state) noexcept : _state{std::move(state)} {
+    }
+
+  public:
+    using value_type = T;
+
+    future() noexcept = default;
+
+    /**
+     * @return whether it refers to a shared state, i.e. its value hasn't been obtained yet.
+     */
+    auto valid() const noexcept -> bool {
+        return static_cast<bool>(_state);
+    }
+
+    /**
+     * @return whether the value, or an exception, is already available.
+     */
+    auto is_ready() const -> bool {
+        return _state->is_satisfied();
+    }
+
+    /**
+     * Blocks until the value, or an exception, is available.
+     */
+    auto wait() const -> void {
+        _state->wait();
+    }
+
+    /**
+     * Blocks until the value is available and then moves it out, or rethrows the exception stored instead.
+     *
+     * @return the value of type T.
+     */
+    auto get() -> T {
+        auto const state = std::move(_state);
+        state->wait();
+        if (state->exception) {
+            std::rethrow_exception(state->exception);
+        }
+        return std::move(*state->value);
+    }
+
+    /**
+     * Registers a continuation that receives this future once it's ready, such that calling get() on it doesn't block.
+     * The continuation is invoked by the thread that satisfies the promise, or immediately when it's already satisfied.
+     *
+     * @param continuation an unary function future<T> -> void.
+     */
+    template <typename UnaryFunction>
+    auto subscribe(UnaryFunction &&continuation) && -> void {
+        auto const state = std::move(_state);
+        state->subscribe([state, continuation = std::forward<UnaryFunction>(continuation)]() mutable {
+            continuation(future<T>{state});
+        });
+    }
+};
+
+/**
+ * The producer side of a future<T>, which is satisfied by either a value or an exception.
+ */
+template <typename T>
+class promise final {
+    std::shared_ptr<detail::shared_state<T>> _state = std::make_shared<detail::shared_state<T>>();
+
+  public:
+    promise() = default;
+    promise(promise const &) = delete;
+    promise(promise &&) noexcept = default;
+    auto operator=(promise const &) -> promise & = delete;
+    auto operator=(promise &&) noexcept -> promise & = default;
+
+    /**
+     * Satisfies the future<T> with a std::future_error when neither a value nor an exception has been set.
+     */
+    ~promise() {
+        if (_state && !_state->is_satisfied()) {
+            set_exception(std::make_exception_ptr(std::future_error{std::future_errc::broken_promise}));
+        }
+    }
+
+    /**
+     * @return the future<T> associated with this promise, which may be obtained only once.
+     */
+    auto get_future() const -> future<T> {
+        return future<T>{_state};
+    }
+
+    template <typename U = T>
+    auto set_value(U &&value) const -> void {
+        _state->complete([&] { _state->value.emplace(std::forward<U>(value)); });
+    }
+
+    auto set_exception(std::exception_ptr exception) const -> void {
+        _state->complete([&] { _state->exception = std::move(exception); });
+    }
+};
+
+/**
+ * @param value the value of the future.
+ * @return a future<T> that is already satisfied with value.
+ */
+template <typename T>
+auto make_ready_future(T &&value) -> future<std::decay_t<T>> {
+    auto ready = promise<std::decay_t<T>>{};
+    ready.set_value(std::forward<T>(value));
+    return ready.get_future();
+}
+
+template <typename T>
+inline constexpr bool is_future_v = false;
+
+template <typename T>
+inline constexpr bool is_future_v<future<T>> = true;
+
+}
+
+#endif
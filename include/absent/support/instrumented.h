@@ -0,0 +1,35 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_INSTRUMENTED_H
+#define RVARAGO_ABSENT_SUPPORT_INSTRUMENTED_H
+
+#ifdef RVARAGO_ABSENT_INSTRUMENTATION
+namespace rvarago::absent::instrumentation {
+inline namespace enabled {
+namespace detail {
+
+template <typename UnaryFunction, bool Timed>
+class named_stage;
+
+}
+}
+}
+#endif
+
+namespace rvarago::absent::detail {
+
+/**
+ * Whether a stage of type F is instrumented, such that the combinators notify it when it's skipped.
+ *
+ * It's kept apart from absent/instrumentation.h, such that the combinators don't include the heavier headers needed to
+ * record the statistics.
+ */
+template <typename F>
+inline constexpr bool is_instrumented_v = false;
+
+#ifdef RVARAGO_ABSENT_INSTRUMENTATION
+template <typename F, bool Timed>
+inline constexpr bool is_instrumented_v<instrumentation::detail::named_stage<F, Timed>> = true;
+#endif
+
+}
+
+#endif
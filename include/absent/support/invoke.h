@@ -0,0 +1,54 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_INVOKE_H
+#define RVARAGO_ABSENT_SUPPORT_INVOKE_H
+
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::detail {
+
+/**
+ * A minimal replacement for std::invoke, such that the combinators don't need to include <functional>, which is one of
+ * the heaviest standard headers.
+ *
+ * It calls a callable object, or a pointer to a member function or to a data member of an object that is passed either
+ * directly or via something that dereferences to it (e.g. a raw or a smart pointer). Unlike std::invoke, it doesn't
+ * unwrap std::reference_wrapper when calling pointers to members.
+ */
+template <typename Class, typename Object,
+          std::enable_if_t<std::is_base_of_v<Class, std::remove_cv_t<std::remove_reference_t<Object>>>, int> = 0>
+constexpr auto object_of(Object &&object) noexcept -> Object && {
+    return std::forward<Object>(object);
+}
+
+template <typename Class, typename Object,
+          std::enable_if_t<!std::is_base_of_v<Class, std::remove_cv_t<std::remove_reference_t<Object>>>, int> = 0>
+constexpr auto object_of(Object &&object) noexcept(noexcept(*std::forward<Object>(object)))
+    -> decltype(*std::forward<Object>(object)) {
+    return *std::forward<Object>(object);
+}
+
+template <typename Member, typename Class, typename Object, typename... Args,
+          std::enable_if_t<std::is_function_v<Member>, int> = 0>
+constexpr auto invoke(Member Class::*f, Object &&object, Args &&... args) noexcept(
+    noexcept((object_of<Class>(std::forward<Object>(object)).*f)(std::forward<Args>(args)...)))
+    -> decltype((object_of<Class>(std::forward<Object>(object)).*f)(std::forward<Args>(args)...)) {
+    return (object_of<Class>(std::forward<Object>(object)).*f)(std::forward<Args>(args)...);
+}
+
+template <typename Member, typename Class, typename Object, std::enable_if_t<!std::is_function_v<Member>, int> = 0>
+constexpr auto invoke(Member Class::*member, Object &&object) noexcept(
+    noexcept(object_of<Class>(std::forward<Object>(object)).*member))
+    -> decltype((object_of<Class>(std::forward<Object>(object)).*member)) {
+    return object_of<Class>(std::forward<Object>(object)).*member;
+}
+
+template <typename Function, typename... Args,
+          std::enable_if_t<!std::is_member_pointer_v<std::remove_cv_t<std::remove_reference_t<Function>>>, int> = 0>
+constexpr auto invoke(Function &&f, Args &&... args) noexcept(noexcept(std::forward<Function>(f)(
+    std::forward<Args>(args)...))) -> decltype(std::forward<Function>(f)(std::forward<Args>(args)...)) {
+    return std::forward<Function>(f)(std::forward<Args>(args)...);
+}
+
+}
+
+#endif
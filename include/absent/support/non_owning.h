@@ -0,0 +1,35 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_NONOWNING_H
+#define RVARAGO_ABSENT_SUPPORT_NONOWNING_H
+
+#include <type_traits>
+
+namespace rvarago::absent::detail {
+
+/***
+ * Whether the nullable type N doesn't own its wrapped value, but merely refers to it (e.g. support::optional_ref<A>).
+ *
+ * The combinators treat an rvalue non-owning nullable as an lvalue, and never move the wrapped value out of it. Non-owning
+ * nullables opt in by specialising it.
+ */
+template <typename N>
+struct is_non_owning : std::false_type {};
+
+template <typename N>
+inline constexpr bool is_non_owning_v = is_non_owning<N>::value;
+
+/***
+ * The nullable of the same kind as Nullable that wraps a new value of type B, i.e. Nullable<B> by default.
+ *
+ * Non-owning nullables, which can't hold a new value, specialise it to name an owning nullable instead.
+ */
+template <template <typename> typename Nullable, typename B>
+struct rebind {
+    using type = Nullable<B>;
+};
+
+template <template <typename> typename Nullable, typename B>
+using rebind_t = typename rebind<Nullable, B>::type;
+
+}
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_OPTIONALREF_H
+#define RVARAGO_ABSENT_SUPPORT_OPTIONALREF_H
+
+#include "absent/support/non_owning.h"
+
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace rvarago::absent::support {
+
+/**
+ * A non-owning nullable reference to an object of type T, which is either empty or refers to an object that must
+ * outlive it. Copying it copies the reference, never the referred object.
+ *
+ * It can't be constructed from a temporary, hence it can't refer to a dangling object by accident. Since it doesn't own
+ * the referred object, the combinators treat an rvalue optional_ref as an lvalue and never move the object out of it.
+ */
+template <typename T>
+class optional_ref final {
+    T *_referred = nullptr;
+
+  public:
+    using value_type = T;
+
+    /**
+     * Creates an empty optional_ref.
+     */
+    constexpr optional_ref() noexcept = default;
+
+    constexpr optional_ref(std::nullopt_t) noexcept {
+    }
+
+    /**
+     * Creates an optional_ref referring to referred.
+     */
+    constexpr optional_ref(T &referred) noexcept : _referred{std::addressof(referred)} {
+    }
+
+    optional_ref(std::remove_const_t<T> &&) = delete;
+
+    /**
+     * Creates an optional_ref<T const> from an optional_ref<T>.
+     */
+    template <typename U, std::enable_if_t<std::is_same_v<T, U const> && !std::is_same_v<T, U>, int> = 0>
+    constexpr optional_ref(optional_ref<U> other) noexcept : _referred{other ? std::addressof(*other) : nullptr} {
+    }
+
+    /**
+     * @return whether it refers to an object.
+     */
+    constexpr auto has_value() const noexcept -> bool {
+        return _referred != nullptr;
+    }
+
+    constexpr explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    /**
+     * Unchecked access to the referred object, which must exist.
+     */
+    constexpr auto operator*() const noexcept -> T & {
+        return *_referred;
+    }
+
+    constexpr auto operator->() const noexcept -> T * {
+        return _referred;
+    }
+
+    /**
+     * @return an optional holding a copy of the referred object, or an empty optional.
+     */
+    constexpr auto to_optional() const -> std::optional<std::remove_const_t<T>> {
+        if (!has_value()) {
+            return std::nullopt;
+        }
+        return *_referred;
+    }
+
+    /**
+     * Two optional_ref are equal when both are empty, or when they refer to the same object.
+     */
+    friend constexpr auto operator==(optional_ref const &lhs, optional_ref const &rhs) noexcept -> bool {
+        return lhs._referred == rhs._referred;
+    }
+
+    friend constexpr auto operator!=(optional_ref const &lhs, optional_ref const &rhs) noexcept -> bool {
+        return !(lhs == rhs);
+    }
+};
+
+}
+
+namespace rvarago::absent::detail {
+
+template <typename T>
+struct is_non_owning<support::optional_ref<T>> : std::true_type {};
+
+/***
+ * A non-owning optional_ref can't hold a new value, hence it's rebound to std::optional<B>.
+ */
+template <typename B>
+struct rebind<support::optional_ref, B> {
+    using type = std::optional<B>;
+};
+
+}
+
+#endif
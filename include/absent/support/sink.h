@@ -1,7 +1,8 @@
 #ifndef RVARAGO_ABSENT_SUPPORT_SINK_H
 #define RVARAGO_ABSENT_SUPPORT_SINK_H
 
-#include <functional>
+#include "absent/support/invoke.h"
+
 #include <utility>
 
 namespace rvarago::absent::support {
@@ -13,8 +14,10 @@ namespace rvarago::absent::support {
  * @return a new callable that discards the parameters sent to it.
  */
 template <typename NullaryFunction>
-constexpr auto sink(NullaryFunction &&f) noexcept(noexcept(std::invoke(std::declval<NullaryFunction>()))) {
-    return [f = std::forward<NullaryFunction>(f)](auto &&...) { return std::invoke(std::forward<NullaryFunction>(f)); };
+constexpr auto sink(NullaryFunction &&f) noexcept(noexcept(absent::detail::invoke(std::declval<NullaryFunction>()))) {
+    return [f = std::forward<NullaryFunction>(f)](auto &&...) {
+        return absent::detail::invoke(std::forward<NullaryFunction>(f));
+    };
 }
 
 }
@@ -0,0 +1,248 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_SMALLVECTOR_H
+#define RVARAGO_ABSENT_SUPPORT_SMALLVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent::support {
+
+/**
+ * A sequence of elements of type T that stores up to N of them inline, and only moves them to the heap when it grows
+ * beyond N, hence it doesn't allocate as long as it holds at most N elements.
+ *
+ * Unlike std::vector<T>, moving it when it holds its elements inline moves each one of them, rather than the buffer.
+ */
+template <typename T, std::size_t N>
+class small_vector final {
+    static_assert(N > 0, "There must be room for at least one element inline");
+
+    std::size_t _size = 0;
+    std::size_t _capacity = N;
+    T *_heap = nullptr;
+    alignas(T) unsigned char _inline[N * sizeof(T)];
+
+    auto inline_data() noexcept -> T * {
+        return std::launder(reinterpret_cast<T *>(_inline));
+    }
+
+    auto inline_data() const noexcept -> T const * {
+        return std::launder(reinterpret_cast<T const *>(_inline));
+    }
+
+    auto destroy() noexcept -> void {
+        std::destroy_n(data(), _size);
+        if (_heap) {
+            std::allocator<T>{}.deallocate(_heap, _capacity);
+        }
+        _size = 0;
+        _capacity = N;
+        _heap = nullptr;
+    }
+
+    auto steal(small_vector &&other) noexcept(std::is_nothrow_move_constructible_v<T>) -> void {
+        if (other._heap) {
+            _heap = std::exchange(other._heap, nullptr);
+            _size = std::exchange(other._size, 0);
+            _capacity = std::exchange(other._capacity, N);
+        } else {
+            std::uninitialized_move_n(other.data(), other._size, inline_data());
+            _size = other._size;
+            other.clear();
+        }
+    }
+
+    auto grow(std::size_t capacity) -> void {
+        auto *const heap = std::allocator<T>{}.allocate(capacity);
+        try {
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                std::uninitialized_move_n(data(), _size, heap);
+            } else {
+                std::uninitialized_copy_n(data(), _size, heap);
+            }
+        } catch (...) {
+            std::allocator<T>{}.deallocate(heap, capacity);
+            throw;
+        }
+        auto const size = _size;
+        destroy();
+        _heap = heap;
+        _size = size;
+        _capacity = capacity;
+    }
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = T const &;
+    using iterator = T *;
+    using const_iterator = T const *;
+
+    small_vector() noexcept = default;
+
+    small_vector(std::initializer_list<T> elements) {
+        reserve(elements.size());
+        for (auto const &element : elements) {
+            emplace_back(element);
+        }
+    }
+
+    small_vector(small_vector const &other) {
+        reserve(other._size);
+        for (auto const &element : other) {
+            emplace_back(element);
+        }
+    }
+
+    small_vector(small_vector &&other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        steal(std::move(other));
+    }
+
+    auto operator=(small_vector const &other) -> small_vector & {
+        if (this != &other) {
+            clear();
+            reserve(other._size);
+            for (auto const &element : other) {
+                emplace_back(element);
+            }
+        }
+        return *this;
+    }
+
+    auto operator=(small_vector &&other) noexcept(std::is_nothrow_move_constructible_v<T>) -> small_vector & {
+        if (this != &other) {
+            destroy();
+            steal(std::move(other));
+        }
+        return *this;
+    }
+
+    ~small_vector() {
+        destroy();
+    }
+
+    /**
+     * @return whether the elements are stored inline rather than on the heap.
+     */
+    auto is_inline() const noexcept -> bool {
+        return _heap == nullptr;
+    }
+
+    auto size() const noexcept -> std::size_t {
+        return _size;
+    }
+
+    auto empty() const noexcept -> bool {
+        return _size == 0;
+    }
+
+    auto capacity() const noexcept -> std::size_t {
+        return _capacity;
+    }
+
+    auto data() noexcept -> T * {
+        return _heap ? _heap : inline_data();
+    }
+
+    auto data() const noexcept -> T const * {
+        return _heap ? _heap : inline_data();
+    }
+
+    auto begin() noexcept -> T * {
+        return data();
+    }
+
+    auto begin() const noexcept -> T const * {
+        return data();
+    }
+
+    auto end() noexcept -> T * {
+        return data() + _size;
+    }
+
+    auto end() const noexcept -> T const * {
+        return data() + _size;
+    }
+
+    /**
+     * Unchecked access to the element at index, which must be less than size().
+     */
+    auto operator[](std::size_t index) noexcept -> T & {
+        return data()[index];
+    }
+
+    auto operator[](std::size_t index) const noexcept -> T const & {
+        return data()[index];
+    }
+
+    auto front() noexcept -> T & {
+        return data()[0];
+    }
+
+    auto front() const noexcept -> T const & {
+        return data()[0];
+    }
+
+    auto back() noexcept -> T & {
+        return data()[_size - 1];
+    }
+
+    auto back() const noexcept -> T const & {
+        return data()[_size - 1];
+    }
+
+    /**
+     * Makes room for at least capacity elements, moving the existing ones to the heap if capacity exceeds N.
+     */
+    auto reserve(std::size_t capacity) -> void {
+        if (capacity > _capacity) {
+            grow(capacity);
+        }
+    }
+
+    template <typename... Args>
+    auto emplace_back(Args &&... args) -> T & {
+        if (_size == _capacity) {
+            // Constructs the new element before growing, since args may refer to an existing element.
+            T element(std::forward<Args>(args)...);
+            grow(std::max(2 * _capacity, _size + 1));
+            ::new (static_cast<void *>(data() + _size)) T(std::move(element));
+        } else {
+            ::new (static_cast<void *>(data() + _size)) T(std::forward<Args>(args)...);
+        }
+        return data()[_size++];
+    }
+
+    auto push_back(T const &element) -> void {
+        emplace_back(element);
+    }
+
+    auto push_back(T &&element) -> void {
+        emplace_back(std::move(element));
+    }
+
+    /**
+     * Destroys the elements, but keeps the capacity.
+     */
+    auto clear() noexcept -> void {
+        std::destroy_n(data(), _size);
+        _size = 0;
+    }
+
+    friend auto operator==(small_vector const &lhs, small_vector const &rhs) -> bool {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend auto operator!=(small_vector const &lhs, small_vector const &rhs) -> bool {
+        return !(lhs == rhs);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_THREADPOOL_H
+#define RVARAGO_ABSENT_SUPPORT_THREADPOOL_H
+
+#include "absent/support/future.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rvarago::absent::support {
+
+/**
+ * An executor that runs tasks on a fixed number of worker threads, in the order they were submitted.
+ *
+ * An executor is any object with a member function execute(f) that eventually invokes the nullary function f, possibly
+ * on another thread.
+ */
+class thread_pool final {
+    std::mutex _mutex;
+    std::condition_variable _pending_condition;
+    std::deque<detail::unique_task> _pending;
+    bool _is_stopping = false;
+    std::vector<std::thread> _workers;
+
+    auto work() -> void {
+        for (;;) {
+            auto task = detail::unique_task{};
+            {
+                auto lock = std::unique_lock{_mutex};
+                _pending_condition.wait(lock, [this] { return _is_stopping || !_pending.empty(); });
+                if (_pending.empty()) {
+                    return;
+                }
+                task = std::move(_pending.front());
+                _pending.pop_front();
+            }
+            task();
+        }
+    }
+
+  public:
+    /**
+     * Starts threads workers, or as many as the hardware supports when threads is zero.
+     */
+    explicit thread_pool(std::size_t threads = 0) {
+        if (threads == 0) {
+            threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        }
+        _workers.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            _workers.emplace_back([this] { work(); });
+        }
+    }
+
+    thread_pool(thread_pool const &) = delete;
+    auto operator=(thread_pool const &) -> thread_pool & = delete;
+
+    /**
+     * Runs the remaining tasks, including the ones they submit, and then joins the workers.
+     */
+    ~thread_pool() {
+        {
+            auto const lock = std::lock_guard{_mutex};
+            _is_stopping = true;
+        }
+        _pending_condition.notify_all();
+        for (auto &worker : _workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * Submits the nullary function f to be invoked by a worker.
+     */
+    template <typename NullaryFunction>
+    auto execute(NullaryFunction &&f) -> void {
+        {
+            auto const lock = std::lock_guard{_mutex};
+            _pending.emplace_back(std::forward<NullaryFunction>(f));
+        }
+        _pending_condition.notify_one();
+    }
+
+    auto size() const noexcept -> std::size_t {
+        return _workers.size();
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_TIMER_H
+#define RVARAGO_ABSENT_SUPPORT_TIMER_H
+
+#include "absent/support/future.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rvarago::absent::support {
+
+/**
+ * Runs nullary functions at given points in time on a single background thread, such that waiting for them doesn't hold
+ * the thread of an executor.
+ *
+ * The functions run on the background thread, one after the other, hence they should only be short, e.g. submitting a
+ * task to an executor. The ones still pending when the timer is destroyed are dropped without being called.
+ */
+class timer final {
+    struct entry final {
+        std::chrono::steady_clock::time_point when;
+        std::uint64_t sequence;
+        mutable detail::unique_task task;
+    };
+
+    // Orders the entries such that the top of the queue is the earliest one, and the first scheduled among equals.
+    struct later final {
+        auto operator()(entry const &lhs, entry const &rhs) const noexcept -> bool {
+            return lhs.when != rhs.when ? lhs.when > rhs.when : lhs.sequence > rhs.sequence;
+        }
+    };
+
+    std::mutex _mutex;
+    std::condition_variable _changed;
+    std::priority_queue<entry, std::vector<entry>, later> _pending;
+    std::uint64_t _sequence = 0;
+    bool _is_stopping = false;
+    std::thread _worker;
+
+    auto work() -> void {
+        auto lock = std::unique_lock{_mutex};
+        for (;;) {
+            if (_is_stopping) {
+                return;
+            }
+            if (_pending.empty()) {
+                _changed.wait(lock);
+                continue;
+            }
+            if (auto const when = _pending.top().when; std::chrono::steady_clock::now() < when) {
+                _changed.wait_until(lock, when);
+                continue;
+            }
+            auto task = std::move(_pending.top().task);
+            _pending.pop();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+  public:
+    timer() : _worker{[this] { work(); }} {
+    }
+
+    timer(timer const &) = delete;
+    auto operator=(timer const &) -> timer & = delete;
+
+    ~timer() {
+        {
+            auto const lock = std::lock_guard{_mutex};
+            _is_stopping = true;
+        }
+        _changed.notify_all();
+        _worker.join();
+    }
+
+    /**
+     * @return a timer shared by the whole program, which is started on first use.
+     */
+    static auto instance() -> timer & {
+        static timer global;
+        return global;
+    }
+
+    /**
+     * Schedules the nullary function f to be invoked once when has been reached.
+     */
+    template <typename NullaryFunction>
+    auto schedule_at(std::chrono::steady_clock::time_point when, NullaryFunction &&f) -> void {
+        {
+            auto const lock = std::lock_guard{_mutex};
+            _pending.push(entry{when, _sequence++, detail::unique_task{std::forward<NullaryFunction>(f)}});
+        }
+        _changed.notify_one();
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,152 @@
+#ifndef RVARAGO_ABSENT_SUPPORT_WORKSTEALINGPOOL_H
+#define RVARAGO_ABSENT_SUPPORT_WORKSTEALINGPOOL_H
+
+#include "absent/support/future.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rvarago::absent::support {
+
+/**
+ * An executor that gives each worker thread its own queue of tasks. A worker runs the most recently submitted task of
+ * its own queue first, and when it's empty, it steals the oldest task from the queue of another worker.
+ *
+ * Tasks submitted by a worker go to its own queue, such that nested tasks stay on the same thread while the other
+ * workers are busy, whereas tasks submitted from outside are spread across the queues.
+ */
+class work_stealing_pool final {
+    struct queue final {
+        std::mutex mutex;
+        std::deque<detail::unique_task> tasks;
+    };
+
+    struct worker_identity final {
+        work_stealing_pool const *pool = nullptr;
+        std::size_t index = 0;
+    };
+
+    std::vector<std::unique_ptr<queue>> _queues;
+    std::atomic<std::size_t> _pending{0};
+    std::atomic<std::size_t> _next{0};
+    std::mutex _sleep_mutex;
+    std::condition_variable _sleep_condition;
+    bool _is_stopping = false;
+    std::vector<std::thread> _workers;
+
+    static auto current_worker() -> worker_identity & {
+        thread_local worker_identity identity;
+        return identity;
+    }
+
+    auto try_pop(std::size_t index) -> detail::unique_task {
+        {
+            auto &own = *_queues[index];
+            auto const lock = std::lock_guard{own.mutex};
+            if (!own.tasks.empty()) {
+                auto task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                _pending.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+        for (std::size_t offset = 1; offset < _queues.size(); ++offset) {
+            auto &victim = *_queues[(index + offset) % _queues.size()];
+            auto const lock = std::lock_guard{victim.mutex};
+            if (!victim.tasks.empty()) {
+                auto task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                _pending.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+        return detail::unique_task{};
+    }
+
+    auto work(std::size_t index) -> void {
+        current_worker() = worker_identity{this, index};
+        for (;;) {
+            if (auto task = try_pop(index); task) {
+                task();
+                continue;
+            }
+            auto lock = std::unique_lock{_sleep_mutex};
+            _sleep_condition.wait(lock, [this] { return _is_stopping || _pending.load() > 0; });
+            if (_is_stopping && _pending.load() == 0) {
+                return;
+            }
+        }
+    }
+
+  public:
+    /**
+     * Starts threads workers, or as many as the hardware supports when threads is zero.
+     */
+    explicit work_stealing_pool(std::size_t threads = 0) {
+        if (threads == 0) {
+            threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        }
+        _queues.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            _queues.push_back(std::make_unique<queue>());
+        }
+        _workers.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            _workers.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    work_stealing_pool(work_stealing_pool const &) = delete;
+    auto operator=(work_stealing_pool const &) -> work_stealing_pool & = delete;
+
+    /**
+     * Runs the remaining tasks, including the ones they submit, and then joins the workers.
+     */
+    ~work_stealing_pool() {
+        {
+            auto const lock = std::lock_guard{_sleep_mutex};
+            _is_stopping = true;
+        }
+        _sleep_condition.notify_all();
+        for (auto &worker : _workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * Submits the nullary function f to be invoked by a worker.
+     */
+    template <typename NullaryFunction>
+    auto execute(NullaryFunction &&f) -> void {
+        auto const &worker = current_worker();
+        auto const index =
+            worker.pool == this ? worker.index : _next.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+        _pending.fetch_add(1, std::memory_order_relaxed);
+        {
+            auto &target = *_queues[index];
+            auto const lock = std::lock_guard{target.mutex};
+            target.tasks.emplace_back(std::forward<NullaryFunction>(f));
+        }
+        {
+            // Synchronises with a worker that has just checked _pending, such that it's not missed before sleeping.
+            auto const lock = std::lock_guard{_sleep_mutex};
+        }
+        _sleep_condition.notify_one();
+    }
+
+    auto size() const noexcept -> std::size_t {
+        return _workers.size();
+    }
+};
+
+}
+
+#endif
@@ -1,7 +1,11 @@
 #ifndef RVARAGO_ABSENT_TRANSFORM_H
 #define RVARAGO_ABSENT_TRANSFORM_H
 
-#include <functional>
+#include "absent/support/instrumented.h"
+#include "absent/support/invoke.h"
+#include "absent/support/non_owning.h"
+
+#include <type_traits>
 #include <utility>
 
 namespace rvarago::absent {
@@ -11,20 +15,47 @@ namespace rvarago::absent {
  * - When empty: it should return a new empty nullable N<B>.
  * - When *not* empty: it should return a nullable N<B> wrapping the result of calling f with the input value of type A.
  *
+ * Since a non-owning support::optional_ref<A> can't hold a new value, it returns a std::optional<B> for it instead.
+ *
  * @param input a nullable N<A>.
  * @param mapper an unary function A -> B.
  * @return a new nullable containing the mapped value of type B, possibly empty if input was also empty.
  */
 template <template <typename> typename Nullable, typename A, typename UnaryFunction>
 constexpr auto transform(Nullable<A> const &input,
-                         UnaryFunction &&mapper) noexcept(noexcept(std::invoke(std::declval<UnaryFunction>(),
-                                                                               std::declval<A>())))
-    -> Nullable<decltype(std::invoke(std::declval<UnaryFunction>(), std::declval<A>()))> {
-    using B = decltype(std::invoke(mapper, std::declval<A>()));
+                         UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                  std::declval<A>())))
+    -> detail::rebind_t<Nullable, decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>()))> {
+    using B = decltype(detail::invoke(mapper, std::declval<A>()));
+    using NullableB = detail::rebind_t<Nullable, B>;
     if (!input) {
-        return Nullable<B>{};
+        if constexpr (detail::is_instrumented_v<std::decay_t<UnaryFunction>>) {
+            mapper.record_short_circuit();
+        }
+        return NullableB{};
     } else {
-        return Nullable<B>{std::invoke(std::forward<UnaryFunction>(mapper), *input)};
+        return NullableB{detail::invoke(std::forward<UnaryFunction>(mapper), *input)};
+    }
+}
+
+/***
+ * Overload of transform for an rvalue nullable N<A>, whose wrapped value of type A is moved into the mapping function.
+ */
+template <template <typename> typename Nullable, typename A, typename UnaryFunction,
+          std::enable_if_t<!detail::is_non_owning_v<Nullable<A>>, int> = 0>
+constexpr auto transform(Nullable<A> &&input,
+                         UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                  std::declval<A>())))
+    -> detail::rebind_t<Nullable, decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>()))> {
+    using B = decltype(detail::invoke(mapper, std::declval<A>()));
+    using NullableB = detail::rebind_t<Nullable, B>;
+    if (!input) {
+        if constexpr (detail::is_instrumented_v<std::decay_t<UnaryFunction>>) {
+            mapper.record_short_circuit();
+        }
+        return NullableB{};
+    } else {
+        return NullableB{detail::invoke(std::forward<UnaryFunction>(mapper), std::move(*input))};
     }
 }
 
@@ -33,12 +64,24 @@ constexpr auto transform(Nullable<A> const &input,
  */
 template <template <typename> typename Nullable, typename A, typename UnaryFunction>
 constexpr auto operator|(Nullable<A> const &input,
-                         UnaryFunction &&mapper) noexcept(noexcept(std::invoke(std::declval<UnaryFunction>(),
-                                                                               std::declval<A>())))
-    -> Nullable<decltype(std::invoke(std::declval<UnaryFunction>(), std::declval<A>()))> {
+                         UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                  std::declval<A>())))
+    -> detail::rebind_t<Nullable, decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>()))> {
     return transform(input, std::forward<UnaryFunction>(mapper));
 }
 
+/***
+ * Infix version of transform for an rvalue nullable N<A>.
+ */
+template <template <typename> typename Nullable, typename A, typename UnaryFunction,
+          std::enable_if_t<!detail::is_non_owning_v<Nullable<A>>, int> = 0>
+constexpr auto operator|(Nullable<A> &&input,
+                         UnaryFunction &&mapper) noexcept(noexcept(detail::invoke(std::declval<UnaryFunction>(),
+                                                                                  std::declval<A>())))
+    -> detail::rebind_t<Nullable, decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A>()))> {
+    return transform(std::move(input), std::forward<UnaryFunction>(mapper));
+}
+
 }
 
 #endif
@@ -0,0 +1,104 @@
+#ifndef RVARAGO_ABSENT_TRANSFORMREF_H
+#define RVARAGO_ABSENT_TRANSFORMREF_H
+
+#include "absent/support/invoke.h"
+#include "absent/support/optional_ref.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent {
+
+namespace detail {
+
+template <typename UnaryFunction, typename A>
+using projection_t = decltype(detail::invoke(std::declval<UnaryFunction>(), std::declval<A &>()));
+
+template <typename UnaryFunction, typename A>
+using projected_ref_t = support::optional_ref<std::remove_reference_t<projection_t<UnaryFunction, A>>>;
+
+}
+
+/***
+ * Given a nullable type N<A> (i.e. optional-like object), and an unary function f: A -> B& that returns a reference
+ * into its argument, e.g. to one of its members:
+ * - When empty: it should return a new empty optional_ref<B>.
+ * - When *not* empty: it should return a new optional_ref<B> referring to the object returned by f, without copying
+ * it.
+ *
+ * Since the result refers into input, it must not outlive input. Hence, an rvalue input is rejected unless it's itself
+ * an optional_ref.
+ *
+ * @param input a nullable N<A>, whose wrapped value may be modified via the result when input is not const.
+ * @param mapper an unary function A -> B&.
+ * @return a new optional_ref referring to the projected object, possibly empty if input is also empty.
+ */
+template <template <typename> typename Nullable, typename A, typename UnaryFunction>
+constexpr auto transform_ref(Nullable<A> const &input, UnaryFunction &&mapper) noexcept(
+    noexcept(detail::invoke(std::declval<UnaryFunction>(), std::declval<A const &>())))
+    -> detail::projected_ref_t<UnaryFunction, A const> {
+    static_assert(std::is_lvalue_reference_v<detail::projection_t<UnaryFunction, A const>>,
+                  "The function must return an lvalue reference");
+    if (!input) {
+        return {};
+    } else {
+        return {detail::invoke(std::forward<UnaryFunction>(mapper), *input)};
+    }
+}
+
+/***
+ * Overload of transform_ref for a mutable nullable N<A>, whose wrapped value may be modified via the returned
+ * optional_ref<B>.
+ */
+template <template <typename> typename Nullable, typename A, typename UnaryFunction>
+constexpr auto transform_ref(Nullable<A> &input, UnaryFunction &&mapper) noexcept(
+    noexcept(detail::invoke(std::declval<UnaryFunction>(), std::declval<A &>())))
+    -> detail::projected_ref_t<UnaryFunction, A> {
+    static_assert(std::is_lvalue_reference_v<detail::projection_t<UnaryFunction, A>>,
+                  "The function must return an lvalue reference");
+    if (!input) {
+        return {};
+    } else {
+        return {detail::invoke(std::forward<UnaryFunction>(mapper), *input)};
+    }
+}
+
+/***
+ * Overload of transform_ref for an optional_ref<A>, which may be an rvalue since it doesn't own the referred object.
+ */
+template <typename A, typename UnaryFunction>
+constexpr auto transform_ref(support::optional_ref<A> input, UnaryFunction &&mapper) noexcept(
+    noexcept(detail::invoke(std::declval<UnaryFunction>(), std::declval<A &>())))
+    -> detail::projected_ref_t<UnaryFunction, A> {
+    static_assert(std::is_lvalue_reference_v<detail::projection_t<UnaryFunction, A>>,
+                  "The function must return an lvalue reference");
+    if (!input) {
+        return {};
+    } else {
+        return {detail::invoke(std::forward<UnaryFunction>(mapper), *input)};
+    }
+}
+
+template <template <typename> typename Nullable, typename A, typename UnaryFunction,
+          std::enable_if_t<!detail::is_non_owning_v<Nullable<A>>, int> = 0>
+auto transform_ref(Nullable<A> &&input, UnaryFunction &&mapper) = delete;
+
+/***
+ * Given a nullable type N<A> (i.e. optional-like object), and a pointer to a data member of A of type B, it returns a
+ * new optional_ref<B> referring to such member, or an empty optional_ref<B> when input is empty.
+ *
+ * It's transform_ref for the common case of projecting a member.
+ *
+ * @param input a nullable N<A>.
+ * @param member a pointer to a data member of A of type B.
+ * @return a new optional_ref referring to the member, possibly empty if input is also empty.
+ */
+template <typename Nullable, typename Member, typename A>
+constexpr auto project(Nullable &&input, Member A::*member) noexcept
+    -> decltype(transform_ref(std::forward<Nullable>(input), member)) {
+    return transform_ref(std::forward<Nullable>(input), member);
+}
+
+}
+
+#endif
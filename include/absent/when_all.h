@@ -0,0 +1,151 @@
+#ifndef RVARAGO_ABSENT_WHENALL_H
+#define RVARAGO_ABSENT_WHENALL_H
+
+#include "absent/fuse.h"
+#include "absent/support/cancellation.h"
+#include "absent/support/future.h"
+#include "absent/support/invoke.h"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent {
+
+namespace detail {
+
+/***
+ * Invokes the branch f with token when it accepts a cancellation_token, or with no arguments otherwise.
+ */
+template <typename NullaryFunction>
+auto invoke_branch(NullaryFunction &f, support::cancellation_token const &token) {
+    if constexpr (std::is_invocable_v<NullaryFunction &, support::cancellation_token const &>) {
+        return detail::invoke(f, token);
+    } else {
+        return detail::invoke(f);
+    }
+}
+
+template <typename NullaryFunction>
+using branch_result_t = decltype(invoke_branch(std::declval<NullaryFunction &>(),
+                                               std::declval<support::cancellation_token const &>()));
+
+/***
+ * State shared by the branches of a when_all, where the first branch that comes back empty, or the last one to come
+ * back when none is empty, satisfies the result.
+ */
+template <typename Result, typename Values, typename... Nullables>
+struct when_all_state final {
+    std::tuple<std::optional<Nullables>...> slots;
+    std::atomic<std::size_t> remaining{sizeof...(Nullables)};
+    std::atomic<bool> is_done{false};
+    support::cancellation_source cancellation;
+    support::promise<Result> output;
+
+    auto try_finish() -> bool {
+        return !is_done.exchange(true, std::memory_order_acq_rel);
+    }
+
+    auto fail(std::exception_ptr exception) -> void {
+        if (try_finish()) {
+            cancellation.cancel();
+            output.set_exception(std::move(exception));
+        }
+    }
+
+    template <std::size_t I>
+    auto complete(std::tuple_element_t<I, std::tuple<Nullables...>> &&nullable) -> void {
+        using Fusion = fusion<std::tuple_element_t<I, std::tuple<Nullables...>>>;
+        if (!Fusion::has_value(nullable)) {
+            if (try_finish()) {
+                cancellation.cancel();
+                satisfy_with([&] { return Fusion::template propagate<Result>(std::move(nullable)); });
+            }
+            return;
+        }
+        std::get<I>(slots).emplace(std::move(nullable));
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1 && try_finish()) {
+            satisfy_with([this] { return join(std::index_sequence_for<Nullables...>{}); });
+        }
+    }
+
+    template <std::size_t... Is>
+    auto join(std::index_sequence<Is...>) -> Result {
+        return Result{Values{fusion<Nullables>::value(std::move(*std::get<Is>(slots)))...}};
+    }
+
+    template <typename NullaryFunction>
+    auto satisfy_with(NullaryFunction &&f) -> void {
+        try {
+            output.set_value(detail::invoke(std::forward<NullaryFunction>(f)));
+        } catch (...) {
+            output.set_exception(std::current_exception());
+        }
+    }
+};
+
+template <std::size_t I, typename State, typename Executor, typename NullaryFunction>
+auto schedule_branch(std::shared_ptr<State> const &state, Executor &executor, NullaryFunction &&branch) -> void {
+    executor.execute([state, branch = std::forward<NullaryFunction>(branch)]() mutable {
+        auto const token = state->cancellation.token();
+        if (token.is_cancelled()) {
+            return;
+        }
+        try {
+            state->template complete<I>(invoke_branch(branch, token));
+        } catch (...) {
+            state->fail(std::current_exception());
+        }
+    });
+}
+
+template <typename Executor, typename... NullaryFunctions, std::size_t... Is>
+auto when_all(Executor &executor, std::index_sequence<Is...>, NullaryFunctions &&... branches) {
+    using First = std::tuple_element_t<0, std::tuple<branch_result_t<std::decay_t<NullaryFunctions>>...>>;
+    static_assert((is_same_kind_v<branch_result_t<std::decay_t<NullaryFunctions>>, First> && ...),
+                  "All the branches must return nullables of the same kind");
+
+    using Values = std::tuple<std::decay_t<decltype(fusion<branch_result_t<std::decay_t<NullaryFunctions>>>::value(
+        std::declval<branch_result_t<std::decay_t<NullaryFunctions>>>()))>...>;
+    using Result = typename fusion<First>::template rebind<Values>;
+    using State = when_all_state<Result, Values, branch_result_t<std::decay_t<NullaryFunctions>>...>;
+
+    auto const state = std::make_shared<State>();
+    auto result = state->output.get_future();
+    (schedule_branch<Is>(state, executor, std::forward<NullaryFunctions>(branches)), ...);
+    return result;
+}
+
+}
+
+/***
+ * Given an executor and the nullary functions f1: void -> N<A1>, ..., fn: void -> N<An> returning nullable types of the
+ * same kind (i.e. optional-like objects), it schedules all of them on the executor concurrently:
+ * - When any of them returns an empty nullable: it should satisfy the returned future with a new empty nullable
+ * N<tuple<A1, ..., An>> as soon as that happens, and cancel the remaining functions.
+ * - When none of them returns an empty nullable: it should satisfy the returned future with a new nullable
+ * N<tuple<A1, ..., An>> wrapping the tuple of their values.
+ *
+ * Cancellation is cooperative: a function that is not yet running when cancelled is skipped, whereas a function that
+ * accepts a support::cancellation_token may poll it to stop early. Exceptions thrown by a function are stored in the
+ * returned future and also cancel the remaining functions.
+ *
+ * @param executor an object whose member function execute(g) eventually invokes g, and which outlives the functions.
+ * @param branches nullary functions void -> N<Ai>, or unary functions cancellation_token -> N<Ai>.
+ * @return a future of a new nullable containing the tuple of values, possibly empty if any function returned empty.
+ */
+template <typename Executor, typename... NullaryFunctions>
+auto when_all(Executor &executor, NullaryFunctions &&... branches) {
+    static_assert(sizeof...(NullaryFunctions) > 0, "when_all needs at least one function");
+    return detail::when_all(executor, std::index_sequence_for<NullaryFunctions...>{},
+                            std::forward<NullaryFunctions>(branches)...);
+}
+
+}
+
+#endif
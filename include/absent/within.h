@@ -0,0 +1,103 @@
+#ifndef RVARAGO_ABSENT_WITHIN_H
+#define RVARAGO_ABSENT_WITHIN_H
+
+#include "absent/fuse.h"
+#include "absent/support/deadline.h"
+#include "absent/support/invoke.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent {
+
+namespace detail {
+
+/***
+ * Invokes the stage f with value and deadline when it accepts the deadline, to check its remaining budget, or with
+ * value only otherwise.
+ */
+template <typename UnaryFunction, typename A, typename Clock>
+constexpr auto invoke_within(UnaryFunction &f, A &&value, support::basic_deadline<Clock> const &deadline)
+    -> decltype(auto) {
+    if constexpr (std::is_invocable_v<UnaryFunction &, A &&, support::basic_deadline<Clock> const &>) {
+        return detail::invoke(f, std::forward<A>(value), deadline);
+    } else {
+        return detail::invoke(f, std::forward<A>(value));
+    }
+}
+
+}
+
+/***
+ * Given a deadline, and an unary function f: A -> N<B> (or (A, deadline) -> N<B> to receive the remaining budget), it
+ * returns a new function A -> N<B> for and_then that:
+ * - When the deadline has expired: it should return a new empty nullable N<B> without calling f.
+ * - When the deadline has *not* expired: it should return the result of f.
+ *
+ * Hence, a pipeline such as input >> within(deadline, find_person) >> within(deadline, find_address) stops running its
+ * stages once the budget is spent. The deadline is captured by reference, and must outlive the returned function.
+ *
+ * @param deadline a support::basic_deadline<Clock>, which is checked before each call to f.
+ * @param mapper an unary function A -> N<B>, or a binary function (A, basic_deadline<Clock> const&) -> N<B>.
+ * @return a new function A -> N<B> that skips mapper once deadline has expired.
+ */
+template <typename Clock, typename UnaryFunction>
+auto within(support::basic_deadline<Clock> const &deadline, UnaryFunction &&mapper) {
+    return [&deadline, mapper = std::forward<UnaryFunction>(mapper)](auto &&value) {
+        using NullableB =
+            std::decay_t<decltype(detail::invoke_within(mapper, std::forward<decltype(value)>(value), deadline))>;
+        static_assert(detail::is_fusable_v<NullableB>,
+                      "The function must return a nullable, see transform_within for a function A -> B");
+        static_assert(detail::has_empty_v<NullableB>,
+                      "The nullable can't be empty without an error, see adapters::either::within for an either");
+        if (deadline.expired()) {
+            return detail::fusion<NullableB>::empty();
+        }
+        return NullableB{detail::invoke_within(mapper, std::forward<decltype(value)>(value), deadline)};
+    };
+}
+
+/***
+ * Given a deadline, and an unary function f: A -> B (or (A, deadline) -> B to receive the remaining budget), it returns
+ * a new function A -> N<B> for and_then that:
+ * - When the deadline has expired: it should return a new empty nullable N<B> without calling f.
+ * - When the deadline has *not* expired: it should return a nullable N<B> wrapping the result of f.
+ *
+ * Hence, it's within for the stages of transform, whose result can't be empty by itself, e.g.
+ * input >> transform_within<std::optional>(deadline, to_upper). The deadline is captured by reference, and must outlive
+ * the returned function.
+ *
+ * @param deadline a support::basic_deadline<Clock>, which is checked before each call to f.
+ * @param mapper an unary function A -> B, or a binary function (A, basic_deadline<Clock> const&) -> B.
+ * @return a new function A -> N<B> that skips mapper once deadline has expired.
+ */
+template <template <typename> typename Nullable, typename Clock, typename UnaryFunction>
+auto transform_within(support::basic_deadline<Clock> const &deadline, UnaryFunction &&mapper) {
+    return [&deadline, mapper = std::forward<UnaryFunction>(mapper)](auto &&value) {
+        using NullableB = detail::rebind_t<Nullable, std::decay_t<decltype(detail::invoke_within(
+                                                         mapper, std::forward<decltype(value)>(value), deadline))>>;
+        static_assert(detail::has_empty_v<NullableB>,
+                      "The nullable can't be empty without an error, see adapters::either::within for an either");
+        if (deadline.expired()) {
+            return detail::fusion<NullableB>::empty();
+        }
+        return NullableB{detail::invoke_within(mapper, std::forward<decltype(value)>(value), deadline)};
+    };
+}
+
+/***
+ * Overload of within for a temporary deadline, e.g. within(deadline::after(budget), f), which is deleted since the
+ * returned function would keep a dangling reference to it.
+ */
+template <typename Clock, typename UnaryFunction>
+auto within(support::basic_deadline<Clock> const &&deadline, UnaryFunction &&mapper) = delete;
+
+/***
+ * Overload of transform_within for a temporary deadline, which is deleted for the same reason.
+ */
+template <template <typename> typename Nullable, typename Clock, typename UnaryFunction>
+auto transform_within(support::basic_deadline<Clock> const &&deadline, UnaryFunction &&mapper) = delete;
+
+}
+
+#endif
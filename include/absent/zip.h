@@ -0,0 +1,80 @@
+#ifndef RVARAGO_ABSENT_ZIP_H
+#define RVARAGO_ABSENT_ZIP_H
+
+#include "absent/fuse.h"
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace rvarago::absent {
+
+namespace detail {
+
+template <typename N>
+using fusion_of = fusion<std::remove_cv_t<std::remove_reference_t<N>>>;
+
+template <typename N>
+using value_of_t = std::decay_t<decltype(fusion_of<N>::value(std::declval<N>()))>;
+
+/***
+ * Whether the nullable types Ns are all of the same kind, i.e. they only differ by the types of the wrapped values.
+ */
+template <typename N, typename... Ns>
+inline constexpr bool are_same_kind_v =
+    (is_same_kind_v<std::remove_cv_t<std::remove_reference_t<Ns>>, std::remove_cv_t<std::remove_reference_t<N>>> &&
+     ...);
+
+/***
+ * Checks the presence of all the inputs at once, by folding a bitwise AND rather than branching on each one of them.
+ */
+template <typename... Nullables>
+constexpr auto all_have_value(Nullables const &... inputs) noexcept -> bool {
+    return (static_cast<unsigned>(fusion_of<Nullables>::has_value(inputs)) & ...) != 0;
+}
+
+/***
+ * Propagates the first empty input into a new empty Result, where at least one input must be empty.
+ */
+template <typename Result, typename Nullable, typename... Nullables>
+constexpr auto propagate_first(Nullable &&input, Nullables &&... inputs) -> Result {
+    if constexpr (sizeof...(Nullables) == 0) {
+        return fusion_of<Nullable>::template propagate<Result>(std::forward<Nullable>(input));
+    } else {
+        if (!fusion_of<Nullable>::has_value(input)) {
+            return fusion_of<Nullable>::template propagate<Result>(std::forward<Nullable>(input));
+        }
+        return propagate_first<Result>(std::forward<Nullables>(inputs)...);
+    }
+}
+
+}
+
+/***
+ * Given the nullable types N<A1>, ..., N<An> of the same kind (i.e. optional-like objects):
+ * - When any of them is empty: it should return a new empty nullable N<tuple<A1, ..., An>>, propagated from the first
+ * empty input.
+ * - When none of them is empty: it should return a new nullable N<tuple<A1, ..., An>> wrapping the tuple of their
+ * values, which are moved out of rvalue inputs.
+ *
+ * The presence of the inputs is checked only once for all of them.
+ *
+ * @param inputs nullables N<Ai> of the same kind.
+ * @return a new nullable containing the tuple of values, possibly empty if any input is also empty.
+ */
+template <typename Nullable, typename... Nullables,
+          std::enable_if_t<detail::are_same_kind_v<Nullable, Nullables...>, int> = 0>
+constexpr auto zip(Nullable &&input, Nullables &&... inputs) {
+    using Result = typename detail::fusion_of<Nullable>::template rebind<
+        std::tuple<detail::value_of_t<Nullable>, detail::value_of_t<Nullables>...>>;
+    if (!detail::all_have_value(input, inputs...)) {
+        return detail::propagate_first<Result>(std::forward<Nullable>(input), std::forward<Nullables>(inputs)...);
+    }
+    return Result{std::tuple<detail::value_of_t<Nullable>, detail::value_of_t<Nullables>...>{
+        detail::fusion_of<Nullable>::value(std::forward<Nullable>(input)),
+        detail::fusion_of<Nullables>::value(std::forward<Nullables>(inputs))...}};
+}
+
+}
+
+#endif
@@ -0,0 +1,213 @@
+/**
+ * The C++20 module rvarago.absent, which exports the combinators, the support types, and the either and validated
+ * adapters, such that they can be imported with:
+ *
+ *     import rvarago.absent;
+ *
+ * The headers are parsed once when the module is built, rather than in every translation unit that uses them.
+ * Asynchronous pipelines (async, batch, when_all, and first_of), coroutine blocks, instrumentation, and nullable
+ * columns aren't exported, and their headers should be included instead. Nor is the standard library, e.g. <optional>
+ * must still be included (or std imported) to name std::optional.
+ */
+module;
+
+#include "absent/absent.h"
+#include "absent/fuse.h"
+#include "absent/lift.h"
+#include "absent/memoize.h"
+#include "absent/parsing.h"
+#include "absent/ranges.h"
+#include "absent/transform_ref.h"
+#include "absent/within.h"
+#include "absent/zip.h"
+
+#include "absent/support/compact_optional.h"
+#include "absent/support/deadline.h"
+#include "absent/support/execution_status.h"
+#include "absent/support/from_variant.h"
+#include "absent/support/optional_ref.h"
+#include "absent/support/sink.h"
+#include "absent/support/small_vector.h"
+
+#include "absent/adapters/either/and_then.h"
+#include "absent/adapters/either/attempt.h"
+#include "absent/adapters/either/context.h"
+#include "absent/adapters/either/either.h"
+#include "absent/adapters/either/eval.h"
+#include "absent/adapters/either/for_each.h"
+#include "absent/adapters/either/fuse.h"
+#include "absent/adapters/either/lift.h"
+#include "absent/adapters/either/memoize.h"
+#include "absent/adapters/either/parsing.h"
+#include "absent/adapters/either/ranges.h"
+#include "absent/adapters/either/transform.h"
+#include "absent/adapters/either/within.h"
+#include "absent/adapters/either/zip.h"
+
+#include "absent/adapters/validated/and_then.h"
+#include "absent/adapters/validated/lift.h"
+#include "absent/adapters/validated/transform.h"
+#include "absent/adapters/validated/validated.h"
+#include "absent/adapters/validated/zip.h"
+
+export module rvarago.absent;
+
+export namespace rvarago::absent {
+
+using rvarago::absent::and_then;
+using rvarago::absent::attempt;
+using rvarago::absent::eval;
+using rvarago::absent::for_each;
+using rvarago::absent::from_variant;
+using rvarago::absent::from_variant_ref;
+using rvarago::absent::transform;
+using rvarago::absent::operator>>;
+using rvarago::absent::operator|;
+
+using rvarago::absent::fuse;
+using rvarago::absent::fused;
+using rvarago::absent::run;
+
+using rvarago::absent::lift;
+using rvarago::absent::zip;
+
+using rvarago::absent::project;
+using rvarago::absent::project_variant;
+using rvarago::absent::transform_ref;
+
+using rvarago::absent::eviction;
+using rvarago::absent::memoize;
+using rvarago::absent::memoize_options;
+using rvarago::absent::memoize_statistics;
+using rvarago::absent::memoized;
+
+using rvarago::absent::transform_within;
+using rvarago::absent::within;
+
+}
+
+export namespace rvarago::absent::parsing {
+
+using rvarago::absent::parsing::error;
+using rvarago::absent::parsing::field;
+using rvarago::absent::parsing::fields;
+using rvarago::absent::parsing::floating;
+using rvarago::absent::parsing::integer;
+using rvarago::absent::parsing::key_value;
+
+}
+
+export namespace rvarago::absent::views {
+
+using rvarago::absent::views::and_then_each;
+using rvarago::absent::views::present;
+using rvarago::absent::views::transform_present;
+
+}
+
+export namespace rvarago::absent::support {
+
+using rvarago::absent::support::compact_optional;
+using rvarago::absent::support::reserved;
+using rvarago::absent::support::reserved_max;
+using rvarago::absent::support::reserved_nan;
+using rvarago::absent::support::sentinel_traits;
+
+using rvarago::absent::support::basic_deadline;
+using rvarago::absent::support::coarse_deadline;
+using rvarago::absent::support::coarse_steady_clock;
+using rvarago::absent::support::deadline;
+using rvarago::absent::support::deadline_exceeded;
+
+using rvarago::absent::support::blank;
+using rvarago::absent::support::execution_status;
+using rvarago::absent::support::failure;
+using rvarago::absent::support::success;
+using rvarago::absent::support::unit;
+using rvarago::absent::support::operator==;
+using rvarago::absent::support::operator!=;
+using rvarago::absent::support::operator<;
+using rvarago::absent::support::operator>;
+using rvarago::absent::support::operator<=;
+using rvarago::absent::support::operator>=;
+
+using rvarago::absent::support::optional_ref;
+using rvarago::absent::support::sink;
+using rvarago::absent::support::small_vector;
+
+}
+
+export namespace rvarago::absent::adapters::types {
+
+using rvarago::absent::adapters::types::either;
+using rvarago::absent::adapters::types::in_place_error;
+using rvarago::absent::adapters::types::in_place_error_t;
+using rvarago::absent::adapters::types::in_place_value;
+using rvarago::absent::adapters::types::in_place_value_t;
+
+using rvarago::absent::adapters::types::contextual_error;
+using rvarago::absent::adapters::types::literal;
+using rvarago::absent::adapters::types::validated;
+
+}
+
+export namespace rvarago::absent::adapters::types::literals {
+
+using rvarago::absent::adapters::types::literals::operator""_lit;
+
+}
+
+export namespace rvarago::absent::adapters::either {
+
+using rvarago::absent::adapters::either::and_then;
+using rvarago::absent::adapters::either::attempt;
+using rvarago::absent::adapters::either::eval;
+using rvarago::absent::adapters::either::for_each;
+using rvarago::absent::adapters::either::fuse;
+using rvarago::absent::adapters::either::in_context;
+using rvarago::absent::adapters::either::lift;
+using rvarago::absent::adapters::either::memoize;
+using rvarago::absent::adapters::either::memoize_options;
+using rvarago::absent::adapters::either::memoize_statistics;
+using rvarago::absent::adapters::either::run;
+using rvarago::absent::adapters::either::transform;
+using rvarago::absent::adapters::either::with_context;
+using rvarago::absent::adapters::either::transform_within;
+using rvarago::absent::adapters::either::within;
+using rvarago::absent::adapters::either::zip;
+using rvarago::absent::adapters::either::operator>>;
+using rvarago::absent::adapters::either::operator|;
+
+}
+
+export namespace rvarago::absent::adapters::either::parsing {
+
+using rvarago::absent::adapters::either::parsing::error;
+using rvarago::absent::adapters::either::parsing::field;
+using rvarago::absent::adapters::either::parsing::fields;
+using rvarago::absent::adapters::either::parsing::floating;
+using rvarago::absent::adapters::either::parsing::integer;
+using rvarago::absent::adapters::either::parsing::key_value;
+
+}
+
+export namespace rvarago::absent::adapters::either::views {
+
+using rvarago::absent::adapters::either::views::and_then_each;
+using rvarago::absent::adapters::either::views::errors;
+using rvarago::absent::adapters::either::views::present;
+using rvarago::absent::adapters::either::views::transform_present;
+
+}
+
+export namespace rvarago::absent::adapters::validated {
+
+using rvarago::absent::adapters::validated::and_then;
+using rvarago::absent::adapters::validated::from_either;
+using rvarago::absent::adapters::validated::lift;
+using rvarago::absent::adapters::validated::transform;
+using rvarago::absent::adapters::validated::zip;
+using rvarago::absent::adapters::validated::operator>>;
+using rvarago::absent::adapters::validated::operator|;
+
+}
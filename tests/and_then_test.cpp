@@ -1,5 +1,6 @@
 #include <absent/and_then.h>
 
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -64,4 +65,26 @@ SCENARIO("and_then provides a way to and_then {optional<A>, f: A -> optional<B>}
             }
         }
     }
+
+    GIVEN("A function unique_ptr<int> -> optional<int> that takes ownership of its argument") {
+
+        auto release = [](std::unique_ptr<int> p) { return std::optional{*p}; };
+
+        AND_GIVEN("An rvalue optional<unique_ptr<int>>") {
+
+            WHEN("empty") {
+                THEN("return a new empty optional<int>") {
+                    std::optional<int> bound_none = std::optional<std::unique_ptr<int>>{} >> release;
+                    CHECK(bound_none == std::nullopt);
+                }
+            }
+
+            WHEN("not empty") {
+                THEN("move the wrapped value into the function and return a non-empty and bound optional<int>") {
+                    std::optional<int> bound_some = std::optional{std::make_unique<int>(200)} >> release;
+                    CHECK(bound_some == std::optional{200});
+                }
+            }
+        }
+    }
 }
@@ -0,0 +1,155 @@
+#include <absent/async.h>
+#include <absent/support/thread_pool.h>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+namespace {
+
+/**
+ * Simulates an I/O-bound service whose requests are completed later by a separate thread, rather than by blocking the
+ * thread that issued them.
+ */
+class lookup_service final {
+    std::mutex _mutex;
+    std::vector<std::pair<int, support::promise<std::optional<int>>>> _requests;
+
+  public:
+    auto half_of_even(int x) -> support::future<std::optional<int>> {
+        auto request = support::promise<std::optional<int>>{};
+        auto result = request.get_future();
+        auto const lock = std::lock_guard{_mutex};
+        _requests.emplace_back(x, std::move(request));
+        return result;
+    }
+
+    auto complete_all() -> std::size_t {
+        auto requests = decltype(_requests){};
+        {
+            auto const lock = std::lock_guard{_mutex};
+            requests.swap(_requests);
+        }
+        for (auto const &[x, request] : requests) {
+            request.set_value(x % 2 == 0 ? std::optional{x / 2} : std::nullopt);
+        }
+        return requests.size();
+    }
+};
+
+}
+
+SCENARIO("async combinators chain futures of optional<A> on an executor", "[async]") {
+
+    support::thread_pool pool{2};
+
+    std::atomic<int> calls{0};
+    auto const to_string = [&calls](int x) {
+        ++calls;
+        return std::to_string(x);
+    };
+
+    GIVEN("A future of an empty optional<int>") {
+
+        auto none = support::make_ready_future(std::optional<int>{});
+
+        THEN("return a future of an empty optional without scheduling the function") {
+            auto mapped = transform(std::move(none), pool, to_string);
+            CHECK(mapped.get() == std::nullopt);
+            CHECK(calls == 0);
+        }
+    }
+
+    GIVEN("A future of a non-empty optional<int>") {
+
+        auto some = support::make_ready_future(std::optional<int>{42});
+
+        WHEN("transformed") {
+            auto mapped = transform(std::move(some), pool, to_string);
+
+            THEN("return a future of an optional wrapping the mapped value") {
+                CHECK(mapped.get() == std::optional{std::string{"42"}});
+                CHECK(calls == 1);
+            }
+        }
+
+        WHEN("bound to a function returning an optional") {
+            auto bound = and_then(std::move(some), pool, [](int x) { return std::optional{x + 1}; });
+
+            THEN("return a future of the returned optional") {
+                CHECK(bound.get() == std::optional{43});
+            }
+        }
+
+        WHEN("bound to a function that throws") {
+            auto const failing = [](int) -> std::optional<int> { throw std::runtime_error{"404"}; };
+            auto bound = and_then(std::move(some), pool, failing);
+
+            THEN("return a future that rethrows the exception") {
+                CHECK_THROWS_AS(bound.get(), std::runtime_error);
+            }
+        }
+    }
+
+    GIVEN("A future of an optional<int> evaluated with a fallback") {
+
+        auto const fallback = [&calls] {
+            ++calls;
+            return 0;
+        };
+
+        WHEN("empty") {
+            THEN("return a future of the fallback's result") {
+                CHECK(eval(support::make_ready_future(std::optional<int>{}), pool, fallback).get() == 0);
+                CHECK(calls == 1);
+            }
+        }
+
+        WHEN("not empty") {
+            THEN("return a future of the wrapped value without scheduling the fallback") {
+                CHECK(eval(support::make_ready_future(std::optional<int>{42}), pool, fallback).get() == 42);
+                CHECK(calls == 0);
+            }
+        }
+    }
+
+    GIVEN("Many pipelines whose stages are asynchronous lookups") {
+
+        lookup_service service;
+        auto const lookup = [&service](int x) { return service.half_of_even(x); };
+
+        constexpr int pipelines = 1000;
+        std::vector<support::future<std::string>> results;
+        results.reserve(pipelines);
+        for (int i = 0; i < pipelines; ++i) {
+            auto half = and_then(support::make_ready_future(std::optional<int>{i}), pool, lookup);
+            auto quarter = and_then(std::move(half), pool, lookup);
+            auto label = transform(std::move(quarter), pool, to_string);
+            results.push_back(eval(std::move(label), pool, [] { return std::string{"odd"}; }));
+        }
+
+        WHEN("the lookups complete while all the pipelines are in flight") {
+            std::size_t completed = 0;
+            while (completed < pipelines + pipelines / 2) {
+                completed += service.complete_all();
+                std::this_thread::yield();
+            }
+
+            THEN("short-circuit the pipelines whose lookups are empty") {
+                for (int i = 0; i < pipelines; ++i) {
+                    CHECK(results[static_cast<std::size_t>(i)].get() == (i % 4 == 0 ? std::to_string(i / 4) : "odd"));
+                }
+                CHECK(calls == pipelines / 4);
+            }
+        }
+    }
+}
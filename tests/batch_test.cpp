@@ -0,0 +1,55 @@
+#include <absent/batch.h>
+
+#include <execution>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+SCENARIO("batch transform and and_then provide a way to map a range of optional<A> under an execution policy",
+         "[batch]") {
+
+    GIVEN("A range of optional<int>, with empty and not empty elements") {
+
+        auto inputs = std::vector<std::optional<int>>{};
+        for (int i = 0; i < 10000; ++i) {
+            inputs.push_back(i % 3 == 0 ? std::nullopt : std::optional{i});
+        }
+
+        AND_GIVEN("A function int -> string") {
+
+            auto to_string = [](int x) -> std::string { return std::to_string(x); };
+
+            WHEN("transformed in parallel") {
+                auto outputs = std::vector<std::optional<std::string>>(inputs.size());
+                auto const last = transform(std::execution::par, inputs, outputs, to_string);
+
+                THEN("write the same as transforming each optional<int> into the preallocated outputs") {
+                    CHECK(last == outputs.end());
+                    for (std::size_t i = 0; i < inputs.size(); ++i) {
+                        CHECK(outputs[i] == transform(inputs[i], to_string));
+                    }
+                }
+            }
+        }
+
+        AND_GIVEN("A function int -> optional<int> that is empty for odd numbers") {
+
+            auto halve = [](int x) -> std::optional<int> { return x % 2 == 0 ? std::optional{x / 2} : std::nullopt; };
+
+            WHEN("bound in parallel and vectorized") {
+                auto outputs = std::vector<std::optional<int>>(inputs.size());
+                and_then(std::execution::par_unseq, inputs, outputs, halve);
+
+                THEN("write the same as binding each optional<int> into the preallocated outputs") {
+                    for (std::size_t i = 0; i < inputs.size(); ++i) {
+                        CHECK(outputs[i] == and_then(inputs[i], halve));
+                    }
+                }
+            }
+        }
+    }
+}
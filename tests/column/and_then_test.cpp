@@ -0,0 +1,36 @@
+#include <absent/adapters/column/and_then.h>
+
+#include <optional>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::column;
+using rvarago::absent::adapters::types::from_optionals;
+using rvarago::absent::adapters::types::nullable_column;
+
+SCENARIO("and_then provides a way to map {nullable_column<A>, f: A -> optional<B>} to nullable_column<B>",
+         "[column-and_then]") {
+
+    GIVEN("A function int -> optional<int> that is empty for odd numbers") {
+
+        int calls = 0;
+        auto halve = [&calls](int x) -> std::optional<int> {
+            ++calls;
+            return x % 2 == 0 ? std::optional{x / 2} : std::nullopt;
+        };
+
+        AND_GIVEN("A nullable_column<int>") {
+
+            WHEN("with empty and not empty slots") {
+                auto const column = from_optionals(std::vector<std::optional<int>>{4, std::nullopt, 3});
+
+                THEN("return a nullable_column<int> empty where either the input or the result was empty") {
+                    nullable_column<int> bound = column >> halve;
+                    CHECK(bound.to_optionals() == std::vector<std::optional<int>>{2, std::nullopt, std::nullopt});
+                    CHECK(calls == 2);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,36 @@
+#include <absent/adapters/column/eval.h>
+
+#include <optional>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::column;
+using rvarago::absent::adapters::types::from_optionals;
+
+SCENARIO("eval provides a way to lazily go from nullable_column<A> to a sequence of A", "[column-eval]") {
+
+    GIVEN("A nullable_column<int>") {
+
+        int calls = 0;
+        auto to_minus_one = [&calls] {
+            ++calls;
+            return -1;
+        };
+
+        WHEN("with empty and not empty slots, including past the first word") {
+            auto optionals = std::vector<std::optional<int>>(70, 1);
+            optionals[1] = std::nullopt;
+            optionals[69] = std::nullopt;
+
+            THEN("return the values, with the result of calling the fallback function for each empty slot") {
+                auto const values = eval(from_optionals(optionals), to_minus_one);
+                CHECK(values[0] == 1);
+                CHECK(values[1] == -1);
+                CHECK(values[68] == 1);
+                CHECK(values[69] == -1);
+                CHECK(calls == 2);
+            }
+        }
+    }
+}
@@ -0,0 +1,29 @@
+#include <absent/adapters/column/for_each.h>
+
+#include <optional>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::column;
+using rvarago::absent::adapters::types::from_optionals;
+
+SCENARIO("for_each provides a way to perform a side-effect in the values of a nullable_column<A>",
+         "[column-for_each]") {
+
+    GIVEN("A nullable_column<int>") {
+
+        int counter = 0;
+        auto add_counter = [&counter](auto v) { counter += v; };
+
+        WHEN("with empty and not empty slots") {
+            auto const column = from_optionals(std::vector<std::optional<int>>{1, std::nullopt, 2});
+
+            THEN("perform the side-effect of incrementing the counter only for the not empty slots") {
+                for_each(column, add_counter);
+
+                CHECK(counter == 3);
+            }
+        }
+    }
+}
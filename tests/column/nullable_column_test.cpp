@@ -0,0 +1,86 @@
+#include <absent/adapters/column/nullable_column.h>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using rvarago::absent::adapters::types::from_optionals;
+using rvarago::absent::adapters::types::nullable_column;
+
+SCENARIO("nullable_column provides a columnar storage for a sequence of optional<A>", "[nullable_column]") {
+
+    GIVEN("A sequence of optional<int> spanning more than one word of the validity bitmap") {
+
+        auto optionals = std::vector<std::optional<int>>{};
+        for (int i = 0; i < 130; ++i) {
+            optionals.push_back(i % 3 == 0 ? std::nullopt : std::optional{i});
+        }
+
+        WHEN("converted to a nullable_column<int>") {
+            nullable_column<int> column = from_optionals(optionals);
+
+            THEN("keep the same values and empty slots") {
+                CHECK(column.size() == 130);
+                CHECK(column.null_count() == 44);
+                CHECK_FALSE(column.has_value(129));
+                CHECK(column.has_value(128));
+                CHECK(column[128] == 128);
+                CHECK(column.get(0) == std::nullopt);
+            }
+
+            THEN("convert back to the same sequence of optional<int>") {
+                CHECK(column.to_optionals() == optionals);
+            }
+        }
+    }
+
+    GIVEN("A nullable_column<int> with empty slots") {
+
+        nullable_column<int> column(3);
+
+        WHEN("a slot is set") {
+            column.set(1, 42);
+
+            THEN("hold the value in that slot only") {
+                CHECK(column.get(1) == std::optional{42});
+                CHECK(column.null_count() == 2);
+            }
+
+            AND_WHEN("the values are modified in place") {
+                column.data()[1] += 1;
+
+                THEN("keep the same size and empty slots") {
+                    CHECK(column.get(1) == std::optional{43});
+                    CHECK(column.size() == 3);
+                    CHECK(column.null_count() == 2);
+                }
+            }
+
+            AND_WHEN("the slot is reset") {
+                column.reset(1);
+
+                THEN("become empty again") {
+                    CHECK(column.get(1) == std::nullopt);
+                    CHECK(column == nullable_column<int>(3));
+                }
+            }
+        }
+    }
+
+    GIVEN("A validity bitmap with bits set past the size of the column") {
+
+        auto const validity = std::vector<std::uint64_t>{~std::uint64_t{0}, ~std::uint64_t{0}};
+
+        WHEN("creating a nullable_column<int> of 3 slots from it") {
+            nullable_column<int> column(3, validity);
+
+            THEN("fill the first 3 slots, and ignore the rest of the bitmap") {
+                CHECK(column.null_count() == 0);
+                CHECK(column.validity() == std::vector<std::uint64_t>{0b111});
+                CHECK(column == from_optionals(std::vector<std::optional<int>>{0, 0, 0}));
+            }
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#include <absent/adapters/column/transform.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::column;
+using rvarago::absent::adapters::types::from_optionals;
+using rvarago::absent::adapters::types::nullable_column;
+
+SCENARIO("transform provides a way to map {nullable_column<A>, f: A -> B} to nullable_column<B>",
+         "[column-transform]") {
+
+    GIVEN("A function int -> string") {
+
+        int calls = 0;
+        auto to_string = [&calls](int x) -> std::string {
+            ++calls;
+            return std::to_string(x);
+        };
+
+        AND_GIVEN("A nullable_column<int>") {
+
+            WHEN("with empty and not empty slots") {
+                auto const column = from_optionals(std::vector<std::optional<int>>{1, std::nullopt, 3});
+
+                THEN("return a nullable_column<string> mapping only the not empty slots") {
+                    nullable_column<std::string> mapped = column | to_string;
+                    CHECK(mapped.to_optionals() ==
+                          std::vector<std::optional<std::string>>{std::string{"1"}, std::nullopt, std::string{"3"}});
+                    CHECK(calls == 2);
+                }
+            }
+        }
+    }
+
+    GIVEN("A function double -> double") {
+
+        auto twice = [](double x) { return 2 * x; };
+
+        AND_GIVEN("A nullable_column<double> with fully populated and fully empty words") {
+
+            auto optionals = std::vector<std::optional<double>>{};
+            for (int i = 0; i < 200; ++i) {
+                optionals.push_back(i >= 64 && i < 128 ? std::nullopt : std::optional{double(i)});
+            }
+
+            WHEN("mapped") {
+                nullable_column<double> mapped = transform(from_optionals(optionals), twice);
+
+                THEN("return the same as mapping each optional<double>") {
+                    for (std::size_t i = 0; i < optionals.size(); ++i) {
+                        CHECK(mapped.get(i) == (optionals[i] ? std::optional{twice(*optionals[i])} : std::nullopt));
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,225 @@
+#include <absent/absent.h>
+#include <absent/support/compact_optional.h>
+#include <absent/support/execution_status.h>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::support;
+
+namespace {
+
+struct row_index final {
+    std::uint32_t value;
+
+    constexpr auto operator==(row_index const &rhs) const noexcept -> bool {
+        return value == rhs.value;
+    }
+};
+
+}
+
+template <>
+struct rvarago::absent::support::sentinel_traits<row_index> {
+    static constexpr auto empty() noexcept -> row_index {
+        return {std::numeric_limits<std::uint32_t>::max()};
+    }
+
+    static constexpr auto is_empty(row_index index) noexcept -> bool {
+        return index == empty();
+    }
+};
+
+SCENARIO("compact_optional<T> stores emptiness as a reserved value of T", "[compact_optional]") {
+
+    GIVEN("Types that have a reserved value") {
+
+        THEN("take no more space than the types themselves") {
+            STATIC_REQUIRE(sizeof(compact_optional<row_index>) == sizeof(row_index));
+            STATIC_REQUIRE(sizeof(compact_optional<int const *>) == sizeof(int const *));
+            STATIC_REQUIRE(std::is_trivially_copyable_v<compact_optional<row_index>>);
+        }
+
+        THEN("be empty when holding the reserved value") {
+            STATIC_REQUIRE_FALSE(compact_optional<row_index>{}.has_value());
+            STATIC_REQUIRE_FALSE(
+                compact_optional<row_index>{row_index{std::numeric_limits<std::uint32_t>::max()}}.has_value());
+            STATIC_REQUIRE_FALSE(compact_optional<int const *>{nullptr}.has_value());
+        }
+
+        THEN("not be empty when holding any other value") {
+            STATIC_REQUIRE(compact_optional<row_index>{row_index{0}}.has_value());
+            STATIC_REQUIRE(*compact_optional<row_index>{row_index{42}} == row_index{42});
+        }
+    }
+
+    GIVEN("Arithmetic types, whose every value may be legitimate") {
+
+        THEN("reserve no value, and fall back to a separate flag") {
+            STATIC_REQUIRE(sizeof(compact_optional<int>) == sizeof(std::optional<int>));
+            STATIC_REQUIRE(compact_optional<int>{-1}.has_value());
+            STATIC_REQUIRE(compact_optional<int>{0}.has_value());
+            CHECK(compact_optional<double>{std::numeric_limits<double>::quiet_NaN()}.has_value());
+        }
+
+        THEN("keep the results of combinators, whatever their values") {
+            CHECK((compact_optional<int>{0} | [](int x) { return x - 1; }) == compact_optional<int>{-1});
+        }
+    }
+
+    GIVEN("A type that is only explicitly constructible from another") {
+
+        THEN("not convert implicitly from it") {
+            STATIC_REQUIRE_FALSE(std::is_convertible_v<int, compact_optional<std::vector<int>>>);
+            STATIC_REQUIRE(std::is_constructible_v<compact_optional<std::vector<int>>, int>);
+            STATIC_REQUIRE(std::is_convertible_v<std::vector<int>, compact_optional<std::vector<int>>>);
+            STATIC_REQUIRE(std::is_convertible_v<char const *, compact_optional<std::string>>);
+        }
+    }
+
+    GIVEN("A type that has no reserved value") {
+
+        THEN("fall back to a separate flag") {
+            compact_optional<std::string> none;
+            compact_optional<std::string> some = std::string{"42"};
+
+            CHECK_FALSE(none.has_value());
+            CHECK(some.has_value());
+            CHECK(*some == "42");
+        }
+    }
+
+    GIVEN("A non-empty compact_optional<int>") {
+
+        compact_optional<int> some = 42;
+
+        WHEN("reset") {
+            some.reset();
+
+            THEN("be empty") {
+                CHECK(some == compact_optional<int>{});
+            }
+        }
+    }
+}
+
+SCENARIO("compact_optional<T> works with the combinators", "[compact_optional]") {
+
+    auto const half_of_even = [](int x) { return x % 2 == 0 ? compact_optional<int>{x / 2} : compact_optional<int>{}; };
+    auto const to_string = [](int x) { return std::to_string(x); };
+
+    GIVEN("An empty compact_optional<int>") {
+
+        compact_optional<int> none;
+
+        THEN("short-circuit every combinator") {
+            CHECK_FALSE((none >> half_of_even).has_value());
+            CHECK_FALSE((none | to_string).has_value());
+            CHECK(eval(none, [] { return 0; }) == 0);
+
+            bool is_called = false;
+            for_each(none, [&is_called](int) { is_called = true; });
+            CHECK_FALSE(is_called);
+        }
+    }
+
+    GIVEN("A non-empty compact_optional<int>") {
+
+        compact_optional<int> some = 42;
+
+        THEN("apply every combinator") {
+            CHECK((some >> half_of_even) == compact_optional<int>{21});
+            CHECK((some | to_string) == compact_optional<std::string>{"42"});
+            CHECK(eval(some, [] { return 0; }) == 42);
+
+            int received = 0;
+            for_each(some, [&received](int x) { received = x; });
+            CHECK(received == 42);
+        }
+    }
+
+    GIVEN("An execution_status that depends on a compact_optional<int>") {
+
+        bool is_set = false;
+        auto const set_flag = [&is_set]() -> execution_status {
+            is_set = true;
+            return success;
+        };
+
+        WHEN("the compact_optional<int> is empty") {
+            auto const status = compact_optional<int>{} >> sink(set_flag);
+
+            THEN("fail without triggering the side-effect") {
+                CHECK(status == failure);
+                CHECK_FALSE(is_set);
+            }
+        }
+
+        WHEN("the compact_optional<int> is not empty") {
+            auto const status = compact_optional<int>{42} >> sink(set_flag);
+
+            THEN("succeed by triggering the side-effect") {
+                CHECK(status == success);
+                CHECK(is_set);
+            }
+        }
+    }
+}
+
+SCENARIO("reserved, reserved_max, and reserved_nan opt arithmetic types in to a reserved value", "[compact_optional]") {
+
+    using index = reserved_max<std::uint32_t>;
+    using count = reserved<int, -1>;
+    using price = reserved_nan<double>;
+
+    GIVEN("Arithmetic types wrapped such that they reserve a value") {
+
+        THEN("take no more space than the arithmetic types themselves") {
+            STATIC_REQUIRE(sizeof(compact_optional<index>) == sizeof(std::uint32_t));
+            STATIC_REQUIRE(sizeof(compact_optional<count>) == sizeof(int));
+            STATIC_REQUIRE(sizeof(compact_optional<price>) == sizeof(double));
+            STATIC_REQUIRE(std::is_trivially_copyable_v<compact_optional<count>>);
+        }
+
+        THEN("be empty when holding the reserved value only") {
+            STATIC_REQUIRE_FALSE(compact_optional<index>{std::numeric_limits<std::uint32_t>::max()}.has_value());
+            STATIC_REQUIRE_FALSE(compact_optional<count>{-1}.has_value());
+            CHECK_FALSE(compact_optional<price>{std::numeric_limits<double>::quiet_NaN()}.has_value());
+
+            STATIC_REQUIRE(compact_optional<index>{0u}.has_value());
+            STATIC_REQUIRE(compact_optional<count>{0}.has_value());
+            CHECK(compact_optional<price>{0.5}.has_value());
+        }
+    }
+
+    GIVEN("Functions of the arithmetic types that return the wrapped types") {
+
+        auto const half_of_even = [](int x) { return x % 2 == 0 ? compact_optional<count>{x / 2} : std::nullopt; };
+        auto const with_tax = [](double p) { return price{p * 1.5}; };
+
+        THEN("apply every combinator, and keep the results compact") {
+            compact_optional<count> const some = 42;
+
+            auto const halved = some >> half_of_even;
+            STATIC_REQUIRE(std::is_same_v<decltype(halved), compact_optional<count> const>);
+            CHECK(halved == compact_optional<count>{21});
+            CHECK_FALSE((compact_optional<count>{21} >> half_of_even).has_value());
+            CHECK_FALSE((compact_optional<count>{} >> half_of_even).has_value());
+
+            auto const taxed = compact_optional<price>{2.0} | with_tax;
+            STATIC_REQUIRE(std::is_same_v<decltype(taxed), compact_optional<price> const>);
+            CHECK(eval(taxed, [] { return price{0.0}; }) == 3.0);
+
+            int received = 0;
+            for_each(some, [&received](int x) { received = x; });
+            CHECK(received == 42);
+        }
+    }
+}
@@ -0,0 +1,99 @@
+#include <absent/coroutine.h>
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+namespace {
+
+struct tracked final {
+    int *destructions;
+
+    ~tracked() {
+        ++*destructions;
+    }
+};
+
+}
+
+SCENARIO("block provides a way to unwrap optional<A> by co_await, short-circuiting on empty", "[coroutine]") {
+
+    auto const half_of_even = [](int x) -> std::optional<int> {
+        return x % 2 == 0 ? std::optional{x / 2} : std::nullopt;
+    };
+
+    GIVEN("A block that halves an int twice and keeps both halves in scope") {
+
+        int destructions = 0;
+        int completions = 0;
+
+        auto const quarter = [&](std::optional<int> input) -> block<std::optional<std::string>> {
+            tracked const guard{&destructions};
+            int const x = co_await input;
+            int const half = co_await half_of_even(x);
+            int const quarter = co_await half_of_even(half);
+            ++completions;
+            co_return std::to_string(x) + "/4=" + std::to_string(quarter);
+        };
+
+        WHEN("the input is empty") {
+            std::optional<std::string> result = quarter(std::nullopt);
+
+            THEN("return a new empty optional<string> and destroy the values in scope") {
+                CHECK(result == std::nullopt);
+                CHECK(completions == 0);
+                CHECK(destructions == 1);
+            }
+        }
+
+        WHEN("an intermediate step is empty") {
+            std::optional<std::string> result = quarter(6);
+
+            THEN("return a new empty optional<string> without evaluating the remaining steps") {
+                CHECK(result == std::nullopt);
+                CHECK(completions == 0);
+                CHECK(destructions == 1);
+            }
+        }
+
+        WHEN("no step is empty") {
+            std::optional<std::string> result = quarter(8);
+
+            THEN("return a new optional<string> built from all the intermediate values") {
+                CHECK(result == std::optional{std::string{"8/4=2"}});
+                CHECK(completions == 1);
+                CHECK(destructions == 1);
+            }
+        }
+    }
+
+    GIVEN("A block that awaits an rvalue optional<unique_ptr<int>>") {
+
+        auto const unbox = [](std::optional<std::unique_ptr<int>> input) -> block<std::optional<int>> {
+            std::unique_ptr<int> const box = co_await std::move(input);
+            co_return *box;
+        };
+
+        THEN("move the wrapped value out of it") {
+            std::optional<int> result = unbox(std::make_unique<int>(42));
+            CHECK(result == std::optional{42});
+        }
+    }
+
+    GIVEN("A block that throws an exception") {
+
+        auto const fail = [](std::optional<int> input) -> block<std::optional<int>> {
+            int const x = co_await input;
+            throw std::runtime_error{std::to_string(x)};
+        };
+
+        THEN("propagate the exception to the caller") {
+            CHECK_THROWS_AS(static_cast<std::optional<int>>(fail(42)), std::runtime_error);
+        }
+    }
+}
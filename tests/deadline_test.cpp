@@ -0,0 +1,66 @@
+#include <absent/support/deadline.h>
+
+#include <chrono>
+
+#include <catch2/catch.hpp>
+
+#include "manual_clock.h"
+
+using namespace rvarago::absent;
+using rvarago::absent::tests::manual_clock;
+
+SCENARIO("basic_deadline amortizes the reads of its clock", "[deadline]") {
+
+    manual_clock::current = manual_clock::time_point{};
+    manual_clock::reads = 0;
+
+    GIVEN("A deadline that reads the clock on every check") {
+
+        auto const deadline = support::basic_deadline<manual_clock>::after(std::chrono::milliseconds{100});
+
+        THEN("report the remaining budget, and expire once the clock reaches it") {
+            CHECK_FALSE(deadline.expired());
+            CHECK(deadline.remaining() == std::chrono::milliseconds{100});
+
+            manual_clock::current += std::chrono::milliseconds{60};
+            CHECK_FALSE(deadline.expired());
+            CHECK(deadline.remaining() == std::chrono::milliseconds{40});
+
+            manual_clock::current += std::chrono::milliseconds{40};
+            CHECK(deadline.expired());
+            CHECK(deadline.remaining() == std::chrono::milliseconds::zero());
+        }
+    }
+
+    GIVEN("A deadline that reads the clock once every four checks") {
+
+        auto const deadline = support::basic_deadline<manual_clock>{
+            manual_clock::time_point{std::chrono::milliseconds{100}}, 4};
+        auto const reads = manual_clock::reads;
+
+        THEN("answer from the last reading in between, and stop reading once expired") {
+            manual_clock::current += std::chrono::milliseconds{200};
+            CHECK_FALSE(deadline.expired());
+            CHECK_FALSE(deadline.expired());
+            CHECK_FALSE(deadline.expired());
+            CHECK(manual_clock::reads == reads);
+
+            CHECK(deadline.expired());
+            CHECK(manual_clock::reads == reads + 1);
+
+            CHECK(deadline.expired());
+            CHECK(deadline.expired());
+            CHECK(manual_clock::reads == reads + 1);
+        }
+    }
+
+    GIVEN("A coarse deadline") {
+
+        auto const deadline = support::coarse_deadline::after(std::chrono::hours{1});
+
+        THEN("not expire before its budget elapses") {
+            CHECK_FALSE(deadline.expired());
+            CHECK(deadline.remaining() > std::chrono::minutes{59});
+        }
+    }
+}
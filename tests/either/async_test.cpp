@@ -0,0 +1,65 @@
+#include <absent/adapters/either/async.h>
+#include <absent/support/thread_pool.h>
+
+#include <atomic>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::adapters::either;
+
+SCENARIO("async combinators chain futures of either<A, E> on an executor", "[either][async]") {
+
+    enum class error { odd };
+
+    support::thread_pool pool{2};
+
+    std::atomic<int> calls{0};
+    auto const to_string = [&calls](int x) {
+        ++calls;
+        return std::to_string(x);
+    };
+
+    GIVEN("A future of an either<int, E> in error") {
+
+        auto invalid = support::make_ready_future(types::either<int, error>{error::odd});
+
+        THEN("return a future of a new either in error without scheduling the function") {
+            auto mapped = transform(std::move(invalid), pool, to_string);
+            CHECK(mapped.get() == types::either<std::string, error>{error::odd});
+            CHECK(calls == 0);
+        }
+    }
+
+    GIVEN("A future of an either<int, E> not in error") {
+
+        WHEN("transformed") {
+            auto mapped = transform(support::make_ready_future(types::either<int, error>{42}), pool, to_string);
+
+            THEN("return a future of an either wrapping the mapped value") {
+                CHECK(mapped.get() == types::either<std::string, error>{std::string{"42"}});
+                CHECK(calls == 1);
+            }
+        }
+
+        WHEN("bound to a function returning a future of an either in error") {
+            auto bound = and_then(support::make_ready_future(types::either<int, error>{42}), pool, [](int) {
+                return support::make_ready_future(types::either<int, error>{error::odd});
+            });
+
+            THEN("return a future of the either in error") {
+                CHECK(bound.get() == types::either<int, error>{error::odd});
+            }
+        }
+
+        WHEN("evaluated with a fallback") {
+            auto value = eval(support::make_ready_future(types::either<int, error>{42}), pool, [] { return 0; });
+
+            THEN("return a future of the wrapped value") {
+                CHECK(value.get() == 42);
+            }
+        }
+    }
+}
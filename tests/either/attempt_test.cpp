@@ -1,6 +1,9 @@
 #include <absent/adapters/either/attempt.h>
 
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <string>
 
 #include <catch2/catch.hpp>
 
@@ -20,7 +23,7 @@ SCENARIO("attempt provides a way to wrap a function that may throw an exception
 
                 THEN("return a new invalid either<int, BaseException>") {
                     either<int, std::exception> invalid = attempt(throw_runtime_error);
-                    CHECK(std::holds_alternative<std::exception>(invalid));
+                    CHECK_FALSE(invalid.has_value());
                 }
             }
 
@@ -38,9 +41,37 @@ SCENARIO("attempt provides a way to wrap a function that may throw an exception
 
             THEN("return the result inside a valid either<int, BaseExecption>") {
                 either<int, std::exception> valid = attempt(never_throw);
-                CHECK(std::holds_alternative<int>(valid));
-                CHECK(std::get<int>(valid) == 200);
+                CHECK(valid.has_value());
+                CHECK(*valid == 200);
             }
         }
     }
-}
\ No newline at end of file
+}
+
+SCENARIO("attempt with an allocator wraps the message of an exception into an either<A, S>", "[either-attempt]") {
+
+    std::pmr::monotonic_buffer_resource arena;
+
+    GIVEN("A function that throws") {
+
+        auto throw_runtime_error = []() -> int { throw std::runtime_error{"404"}; };
+
+        THEN("return a new invalid either<int, pmr::string> allocated with the allocator") {
+            either<int, std::pmr::string> const invalid =
+                attempt(std::allocator_arg, std::pmr::polymorphic_allocator<char>{&arena}, throw_runtime_error);
+            CHECK(invalid.error() == "404");
+            CHECK(invalid.error().get_allocator().resource() == &arena);
+        }
+    }
+
+    GIVEN("A function that doesn't throw") {
+
+        auto never_throw = []() -> int { return 200; };
+
+        THEN("return the result inside a valid either<int, string>") {
+            either<int, std::string> const valid = attempt(std::allocator_arg, std::allocator<char>{}, never_throw);
+            CHECK(*valid == 200);
+        }
+    }
+}
+
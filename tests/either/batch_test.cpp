@@ -0,0 +1,65 @@
+#include <absent/adapters/either/batch.h>
+
+#include <execution>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::either;
+using rvarago::absent::adapters::types::either;
+
+SCENARIO("batch transform and and_then provide a way to map a range of either<A, E> under an execution policy",
+         "[either-batch]") {
+
+    struct Error {
+        int code;
+
+        bool operator==(Error const &rhs) const {
+            return code == rhs.code;
+        }
+    };
+
+    GIVEN("A range of either<int, Error>, with valid and invalid elements") {
+
+        auto inputs = std::vector<either<int, Error>>{};
+        for (int i = 0; i < 10000; ++i) {
+            inputs.push_back(i % 3 == 0 ? either<int, Error>{Error{i}} : either<int, Error>{i});
+        }
+
+        AND_GIVEN("A function int -> string") {
+
+            auto to_string = [](int x) -> std::string { return std::to_string(x); };
+
+            WHEN("transformed in parallel") {
+                auto outputs = std::vector<either<std::string, Error>>(inputs.size());
+                auto const last = transform(std::execution::par, inputs, outputs, to_string);
+
+                THEN("write the same as transforming each either<int, Error> into the preallocated outputs") {
+                    CHECK(last == outputs.end());
+                    for (std::size_t i = 0; i < inputs.size(); ++i) {
+                        CHECK(outputs[i] == transform(inputs[i], to_string));
+                    }
+                }
+            }
+        }
+
+        AND_GIVEN("A function int -> either<int, Error> that is invalid for odd numbers") {
+
+            auto halve = [](int x) -> either<int, Error> {
+                return x % 2 == 0 ? either<int, Error>{x / 2} : either<int, Error>{Error{-x}};
+            };
+
+            WHEN("bound in parallel") {
+                auto outputs = std::vector<either<int, Error>>(inputs.size());
+                and_then(std::execution::par, inputs, outputs, halve);
+
+                THEN("write the same as binding each either<int, Error> into the preallocated outputs") {
+                    for (std::size_t i = 0; i < inputs.size(); ++i) {
+                        CHECK(outputs[i] == and_then(inputs[i], halve));
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,123 @@
+#include <absent/adapters/either/and_then.h>
+#include <absent/adapters/either/context.h>
+
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::either;
+using rvarago::absent::adapters::types::contextual_error;
+using rvarago::absent::adapters::types::either;
+using namespace rvarago::absent::adapters::types::literals;
+
+namespace {
+
+enum class code { not_found, timeout };
+
+using error = contextual_error<code>;
+
+auto load_user(int id) -> either<int, error> {
+    if (id < 0) {
+        return error{code::not_found, "user {} not found"_lit, id};
+    }
+    return id * 10;
+}
+
+}
+
+SCENARIO("contextual_error<Code, Depth> defers formatting its frames of context", "[either-context]") {
+
+    GIVEN("A contextual_error") {
+
+        THEN("be trivially copyable and not larger than its frames") {
+            STATIC_REQUIRE(std::is_trivially_copyable_v<error>);
+            STATIC_REQUIRE_FALSE(std::is_constructible_v<error, code, char const (&)[8]>);
+            STATIC_REQUIRE_FALSE(std::is_constructible_v<error, code, char const *>);
+            STATIC_REQUIRE(sizeof(error) <= 64);
+            STATIC_REQUIRE(sizeof(either<int, error>) <= 72);
+        }
+
+        WHEN("formatting it") {
+            auto const e = error{code::timeout, "{} timed out after {} ms"_lit, "shard"_lit, 2.5};
+
+            THEN("replace each placeholder by the next argument") {
+                CHECK(e.code() == code::timeout);
+                CHECK(e.message() == "shard timed out after 2.5 ms");
+            }
+        }
+
+        WHEN("adding context") {
+            auto const e = error{code::not_found, "user {} not found"_lit, 42}
+                               .with_context("while loading user {} from shard {}"_lit, 42, 7u)
+                               .with_context("while handling request {}"_lit, -1);
+
+            THEN("chain the frames that fit, and count the others") {
+                CHECK(e.depth() == 3);
+                CHECK(e.message() == "user 42 not found, while loading user 42 from shard 7, and 1 more");
+            }
+
+            AND_WHEN("adding more frames than fit") {
+                auto const deeper = e.with_context("while retrying"_lit).with_context("while retrying again"_lit);
+
+                THEN("count, but drop them") {
+                    CHECK(deeper.depth() == 5);
+                    CHECK(deeper.message() == "user 42 not found, while loading user 42 from shard 7, and 3 more");
+                }
+            }
+        }
+
+        WHEN("adding context to an error with room for more frames") {
+            auto const e = contextual_error<code, 3>{code::not_found, "user {} not found"_lit, 42}
+                               .with_context("while loading user {} from shard {}"_lit, 42, 7u)
+                               .with_context("while handling request {}"_lit, -1);
+
+            THEN("chain all the frames") {
+                CHECK(e.depth() == 3);
+                CHECK(e.message() ==
+                      "user 42 not found, while loading user 42 from shard 7, while handling request -1");
+            }
+        }
+
+        THEN("compare by code, regardless of the context") {
+            CHECK(error{code::not_found, "a"_lit}.same_code(error{code::not_found, "b"_lit}.with_context("c"_lit)));
+            CHECK_FALSE(error{code::not_found, "a"_lit}.same_code(error{code::timeout, "a"_lit}));
+        }
+    }
+}
+
+SCENARIO("with_context and in_context add frames of context to either<A, contextual_error>", "[either-context]") {
+
+    GIVEN("An either<int, contextual_error> in error") {
+
+        auto const invalid = load_user(-1);
+
+        THEN("with_context adds a frame") {
+            CHECK(with_context(invalid, "while loading shard {}"_lit, 7).error().message() ==
+                  "user -1 not found, while loading shard 7");
+        }
+    }
+
+    GIVEN("An either<int, contextual_error> holding a value") {
+
+        THEN("with_context returns it as-is") {
+            CHECK(*with_context(load_user(4), "while loading shard {}"_lit, 7) == 40);
+        }
+    }
+
+    GIVEN("A pipeline whose stages are wrapped with in_context") {
+
+        auto const check_latency = [](int x) {
+            return x > 100 ? either<int, error>{error{code::timeout, "too slow"_lit}} : either<int, error>{x};
+        };
+
+        auto const load = in_context(load_user, "while loading user from shard {}"_lit, 7);
+        auto const validate = in_context(check_latency, "while validating"_lit);
+
+        THEN("add the context of the failing stage only") {
+            CHECK(*(either<int, error>{4} >> load >> validate) == 40);
+            CHECK((either<int, error>{-1} >> load >> validate).error().message() ==
+                  "user -1 not found, while loading user from shard 7");
+            CHECK((either<int, error>{11} >> load >> validate).error().message() == "too slow, while validating");
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#include <absent/adapters/either/coroutine.h>
+
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::adapters::either;
+
+SCENARIO("block provides a way to unwrap either<A, E> by co_await, short-circuiting on error", "[either][coroutine]") {
+
+    enum class error { odd };
+
+    auto const half_of_even = [](int x) -> types::either<int, error> {
+        return x % 2 == 0 ? types::either<int, error>{x / 2} : types::either<int, error>{error::odd};
+    };
+
+    GIVEN("A block that halves an int twice") {
+
+        int completions = 0;
+
+        auto const quarter = [&](types::either<int, error> input) -> block<types::either<std::string, error>> {
+            int const x = co_await input;
+            int const half = co_await half_of_even(x);
+            int const quarter = co_await half_of_even(half);
+            ++completions;
+            co_return std::to_string(x) + "/4=" + std::to_string(quarter);
+        };
+
+        WHEN("the input is in error") {
+            types::either<std::string, error> result = quarter(error::odd);
+
+            THEN("return a new either<string, E> in error wrapping the same error") {
+                CHECK(result == types::either<std::string, error>{error::odd});
+                CHECK(completions == 0);
+            }
+        }
+
+        WHEN("an intermediate step is in error") {
+            types::either<std::string, error> result = quarter(6);
+
+            THEN("return a new either<string, E> in error without evaluating the remaining steps") {
+                CHECK(result == types::either<std::string, error>{error::odd});
+                CHECK(completions == 0);
+            }
+        }
+
+        WHEN("no step is in error") {
+            types::either<std::string, error> result = quarter(8);
+
+            THEN("return a new either<string, E> built from all the intermediate values") {
+                CHECK(result == types::either<std::string, error>{std::string{"8/4=2"}});
+                CHECK(completions == 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,220 @@
+#include <absent/adapters/either/either.h>
+
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::types;
+
+SCENARIO("either<A, E> holds either a value of type A or an error of type E", "[either]") {
+
+    struct Error {
+        int code;
+
+        bool operator==(Error const &rhs) const {
+            return code == rhs.code;
+        }
+    };
+
+    GIVEN("An either<int, Error> made of trivially copyable types") {
+
+        THEN("be trivially copyable and as small as its largest type plus a flag") {
+            STATIC_REQUIRE(std::is_trivially_copyable_v<either<int, Error>>);
+            STATIC_REQUIRE(sizeof(either<int, Error>) == 2 * sizeof(int));
+        }
+
+        WHEN("holding a value") {
+            constexpr either<int, Error> valid = 42;
+
+            THEN("give unchecked access to the value") {
+                STATIC_REQUIRE(valid.has_value());
+                STATIC_REQUIRE(*valid == 42);
+            }
+        }
+
+        WHEN("holding an error") {
+            either<int, Error> invalid = Error{404};
+
+            THEN("give unchecked access to the error") {
+                CHECK_FALSE(invalid.has_value());
+                CHECK(invalid.error() == Error{404});
+            }
+        }
+    }
+
+    GIVEN("An either<string, string> where A and E are the same type") {
+
+        WHEN("constructed with the in-place tags") {
+            either<std::string, std::string> valid{in_place_value, "200"};
+            either<std::string, std::string> invalid{in_place_error, "404"};
+
+            THEN("hold a value or an error as requested") {
+                CHECK(valid.has_value());
+                CHECK(*valid == "200");
+                CHECK_FALSE(invalid.has_value());
+                CHECK(invalid.error() == "404");
+            }
+        }
+    }
+
+    GIVEN("An either<string, Error> made of a type that is not trivially copyable") {
+
+        THEN("not be trivially copyable, but still copyable") {
+            STATIC_REQUIRE_FALSE(std::is_trivially_copyable_v<either<std::string, Error>>);
+            STATIC_REQUIRE(std::is_copy_constructible_v<either<std::string, Error>>);
+        }
+
+        WHEN("holding a value and assigned an either holding an error") {
+            either<std::string, Error> either_value = std::string{"200"};
+            either<std::string, Error> const either_error = Error{404};
+            either_value = either_error;
+
+            THEN("hold the error") {
+                CHECK(either_value == either_error);
+            }
+
+            AND_WHEN("assigned back an either holding a value") {
+                either_value = either<std::string, Error>{std::string{"200"}};
+
+                THEN("hold the value") {
+                    CHECK(either_value == either<std::string, Error>{std::string{"200"}});
+                }
+            }
+        }
+    }
+
+    GIVEN("An either<unique_ptr<int>, Error> made of a move-only type") {
+
+        THEN("be move-only") {
+            STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<either<std::unique_ptr<int>, Error>>);
+            STATIC_REQUIRE(std::is_nothrow_move_constructible_v<either<std::unique_ptr<int>, Error>>);
+        }
+
+        WHEN("moved") {
+            either<std::unique_ptr<int>, Error> source = std::make_unique<int>(42);
+            either<std::unique_ptr<int>, Error> target = std::move(source);
+
+            THEN("transfer the value") {
+                CHECK(**target == 42);
+            }
+        }
+    }
+
+    GIVEN("An either<string, vector<int>> whose error is only explicitly constructible from an int") {
+
+        THEN("not convert implicitly from an int, as std::variant<string, vector<int>> doesn't either") {
+            STATIC_REQUIRE_FALSE(std::is_convertible_v<int, either<std::string, std::vector<int>>>);
+            STATIC_REQUIRE(std::is_convertible_v<std::vector<int>, either<std::string, std::vector<int>>>);
+            STATIC_REQUIRE(std::is_convertible_v<char const *, either<std::string, std::vector<int>>>);
+        }
+    }
+
+    GIVEN("An either<bool, string> whose value is also convertible from a string literal") {
+
+        THEN("prefer the string, as std::variant<bool, string> does") {
+            either<bool, std::string> const from_literal = "x";
+            CHECK_FALSE(from_literal.has_value());
+            CHECK(from_literal.error() == "x");
+
+            either<bool, std::string> const from_bool = true;
+            CHECK(from_bool.has_value());
+            CHECK(*from_bool);
+        }
+    }
+
+    GIVEN("An either<int, double> whose error is convertible from a double without narrowing") {
+
+        THEN("prefer the double over narrowing it into an int") {
+            either<int, double> const from_double = 1.5;
+            CHECK_FALSE(from_double.has_value());
+            CHECK(from_double.error() == 1.5);
+
+            either<int, double> const from_int = 1;
+            CHECK(from_int.has_value());
+        }
+    }
+}
+
+SCENARIO("either<A, E> supports uses-allocator construction", "[either]") {
+
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::polymorphic_allocator<char> const allocator{&arena};
+
+    GIVEN("An either<int, pmr::string>") {
+
+        THEN("use an allocator when either A or E does") {
+            STATIC_REQUIRE(std::uses_allocator_v<either<int, std::pmr::string>, std::pmr::polymorphic_allocator<char>>);
+            STATIC_REQUIRE_FALSE(std::uses_allocator_v<either<int, int>, std::pmr::polymorphic_allocator<char>>);
+        }
+
+        WHEN("constructed with an allocator") {
+            either<int, std::pmr::string> const invalid{std::allocator_arg, allocator, in_place_error, "404"};
+
+            THEN("allocate the error with it") {
+                CHECK(invalid.error() == "404");
+                CHECK(invalid.error().get_allocator().resource() == &arena);
+            }
+
+            AND_WHEN("copied with another allocator") {
+                std::pmr::monotonic_buffer_resource other_arena;
+                either<int, std::pmr::string> const copy{std::allocator_arg,
+                                                         std::pmr::polymorphic_allocator<char>{&other_arena}, invalid};
+
+                THEN("allocate the copy of the error with the other allocator") {
+                    CHECK(copy == invalid);
+                    CHECK(copy.error().get_allocator().resource() == &other_arena);
+                }
+            }
+        }
+
+        WHEN("emplaced into a pmr::vector") {
+            std::pmr::vector<either<int, std::pmr::string>> eithers(allocator);
+            eithers.emplace_back(42);
+            eithers.emplace_back(in_place_error, "a message long enough not to fit in the small string buffer");
+            eithers.emplace_back(eithers.back());
+
+            THEN("allocate the errors with the allocator of the vector") {
+                CHECK(*eithers[0] == 42);
+                CHECK(eithers[1].error().get_allocator().resource() == &arena);
+                CHECK(eithers[2].error().get_allocator().resource() == &arena);
+            }
+        }
+    }
+
+    GIVEN("A pmr::vector of either<int, pmr::string>") {
+
+        std::pmr::vector<either<int, std::pmr::string>> eithers(allocator);
+
+        WHEN("resized or emplaced without arguments") {
+            eithers.resize(2);
+            eithers.emplace_back();
+
+            THEN("hold value-initialized values rather than errors built from the allocator") {
+                REQUIRE(eithers.size() == 3);
+                for (auto const &element : eithers) {
+                    CHECK(element.has_value());
+                    CHECK(*element == 0);
+                }
+            }
+        }
+    }
+
+    GIVEN("A pmr::vector of either<pmr::string, int>") {
+
+        std::pmr::vector<either<std::pmr::string, int>> eithers(allocator);
+
+        WHEN("resized") {
+            eithers.resize(2);
+
+            THEN("hold empty values that use the allocator of the vector") {
+                CHECK(eithers[0].has_value());
+                CHECK(eithers[0]->empty());
+                CHECK(eithers[1]->get_allocator().resource() == &arena);
+            }
+        }
+    }
+}
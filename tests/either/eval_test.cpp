@@ -1,5 +1,6 @@
 #include <absent/adapters/either/eval.h>
 
+#include <memory>
 #include <optional>
 
 #include <catch2/catch.hpp>
@@ -33,4 +34,24 @@ SCENARIO("eval provides a way to lazily go from either<A, E> to A", "[either-eva
             }
         }
     }
-}
\ No newline at end of file
+
+    GIVEN("An rvalue either<unique_ptr<int>, Error>") {
+
+        auto to_minus_one = [] { return std::make_unique<int>(-1); };
+
+        WHEN("invalid") {
+            THEN("return the result of calling the fallback function") {
+                std::unique_ptr<int> value = eval(either<std::unique_ptr<int>, Error>{Error{}}, to_minus_one);
+                CHECK(*value == -1);
+            }
+        }
+
+        WHEN("valid") {
+            THEN("move the wrapped value out") {
+                std::unique_ptr<int> value =
+                    eval(either<std::unique_ptr<int>, Error>{std::make_unique<int>(1)}, to_minus_one);
+                CHECK(*value == 1);
+            }
+        }
+    }
+}
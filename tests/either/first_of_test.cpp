@@ -0,0 +1,52 @@
+#include <absent/adapters/either/first_of.h>
+#include <absent/support/work_stealing_pool.h>
+
+#include <chrono>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::adapters::either;
+using rvarago::absent::adapters::types::either;
+
+SCENARIO("first_of provides a way to try nullary functions returning either<A, E> in order", "[either][first_of]") {
+
+    struct error {
+        int code;
+
+        bool operator==(error const &rhs) const {
+            return code == rhs.code;
+        }
+    };
+
+    auto const cache = [] { return either<std::string, error>{error{404}}; };
+    auto const replica = [] { return either<std::string, error>{error{503}}; };
+    auto const origin = [] { return either<std::string, error>{std::string{"origin"}}; };
+
+    GIVEN("Functions where one returns an either not in error") {
+
+        THEN("return it") {
+            CHECK(first_of(cache, origin, replica) == either<std::string, error>{std::string{"origin"}});
+        }
+    }
+
+    GIVEN("Functions that all return an either in error") {
+
+        THEN("return the error of the last one") {
+            CHECK(first_of(cache, replica) == either<std::string, error>{error{503}});
+        }
+    }
+
+    GIVEN("Functions hedged on an executor") {
+
+        support::work_stealing_pool pool{4};
+
+        THEN("return a future of the first either not in error, or else of the last error") {
+            CHECK(first_of(pool, std::chrono::milliseconds{1}, cache, origin).get() ==
+                  either<std::string, error>{std::string{"origin"}});
+            CHECK(first_of(pool, std::chrono::hours{1}, cache, cache).get() ==
+                  either<std::string, error>{error{404}});
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #include <absent/adapters/either/for_each.h>
 
+#include <memory>
 #include <optional>
 
 #include <catch2/catch.hpp>
@@ -37,4 +38,26 @@ SCENARIO("for_each provides a way to perform a side-effect in the value wrapped
             }
         }
     }
+
+    GIVEN("An rvalue either<unique_ptr<int>, Error>") {
+
+        int counter = 0;
+        auto add_counter = [&counter](std::unique_ptr<int> p) { counter += *p; };
+
+        WHEN("invalid") {
+            THEN("do nothing") {
+                for_each(either<std::unique_ptr<int>, Error>{Error{}}, add_counter);
+
+                CHECK(counter == 0);
+            }
+        }
+
+        WHEN("valid") {
+            THEN("move the wrapped value into the action to perform the side-effect of incrementing the counter") {
+                for_each(either<std::unique_ptr<int>, Error>{std::make_unique<int>(1)}, add_counter);
+
+                CHECK(counter == 1);
+            }
+        }
+    }
 }
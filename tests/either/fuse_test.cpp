@@ -0,0 +1,94 @@
+#include <absent/adapters/either/fuse.h>
+
+#include <memory_resource>
+#include <string>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters::either;
+using rvarago::absent::adapters::types::either;
+
+SCENARIO("fuse provides a way to build a deferred pipeline run on {either<A, E>} as a single function",
+         "[either-fuse]") {
+
+    struct Error {
+        std::string code;
+        explicit Error(std::string the_code) : code{std::move(the_code)} {
+        }
+
+        bool operator==(Error const &rhs) const {
+            return code == rhs.code;
+        }
+    };
+
+    GIVEN("A pipeline made of a function int -> either<int, Error> followed by a function int -> string") {
+
+        int halve_calls = 0;
+        auto halve = [&halve_calls](int x) -> either<int, Error> {
+            ++halve_calls;
+            if (x % 2 != 0) {
+                return either<int, Error>{Error{"odd"}};
+            }
+            return either<int, Error>{x / 2};
+        };
+
+        int to_string_calls = 0;
+        auto to_string = [&to_string_calls](int x) -> std::string {
+            ++to_string_calls;
+            return std::to_string(x);
+        };
+
+        auto const pipeline = fuse() >> halve | to_string;
+
+        AND_GIVEN("An either<int, Error>") {
+
+            WHEN("invalid") {
+                either<int, Error> invalid{Error{"404"}};
+
+                THEN("return a new invalid either<string, Error> without evaluating any stage") {
+                    either<std::string, Error> result_invalid = invalid | pipeline;
+                    CHECK(result_invalid == either<std::string, Error>{Error{"404"}});
+                    CHECK(halve_calls == 0);
+                    CHECK(to_string_calls == 0);
+                }
+            }
+
+            WHEN("valid but a stage returns an invalid either") {
+                either<int, Error> odd{201};
+
+                THEN("return a new invalid either<string, Error> without evaluating the remaining stages") {
+                    either<std::string, Error> result_invalid = run(odd, pipeline);
+                    CHECK(result_invalid == either<std::string, Error>{Error{"odd"}});
+                    CHECK(halve_calls == 1);
+                    CHECK(to_string_calls == 0);
+                }
+            }
+
+            WHEN("valid and every stage succeeds") {
+                THEN("return a valid either<string, Error> with the result of all stages") {
+                    either<std::string, Error> result_valid = either<int, Error>{400} | pipeline;
+                    CHECK(result_valid == either<std::string, Error>{std::string{"200"}});
+                    CHECK(halve_calls == 1);
+                    CHECK(to_string_calls == 1);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("fuse copies an allocator-aware error with its allocator", "[either-fuse]") {
+
+    GIVEN("An either<int, pmr::string> in error allocated in an arena") {
+
+        std::pmr::monotonic_buffer_resource arena;
+        either<int, std::pmr::string> const invalid{std::allocator_arg, std::pmr::polymorphic_allocator<char>{&arena},
+                                                    rvarago::absent::adapters::types::in_place_error, "404"};
+
+        THEN("allocate the copy of the error in the same arena") {
+            auto const mapped = invalid | (fuse() | [](int x) { return x + 1; });
+            CHECK(mapped.error() == "404");
+            CHECK(mapped.error().get_allocator().resource() == &arena);
+        }
+    }
+}
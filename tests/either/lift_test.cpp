@@ -0,0 +1,46 @@
+#include <absent/adapters/either/lift.h>
+
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::adapters::either;
+
+SCENARIO("lift provides a way to apply a function of several arguments to several either<A, E>", "[either][lift]") {
+
+    struct error {
+        int code;
+
+        bool operator==(error const &rhs) const {
+            return code == rhs.code;
+        }
+    };
+
+    auto const repeat = [](std::string const &text, int times) {
+        std::string result;
+        for (int i = 0; i < times; ++i) {
+            result += text;
+        }
+        return result;
+    };
+
+    GIVEN("An either<string, E> and an either<int, E>") {
+
+        WHEN("none is in error") {
+            THEN("return a new either wrapping the result of the function") {
+                types::either<std::string, error> lifted =
+                    lift(repeat)(types::either<std::string, error>{std::string{"ab"}}, types::either<int, error>{2});
+                CHECK(lifted == types::either<std::string, error>{std::string{"abab"}});
+            }
+        }
+
+        WHEN("the second one is in error") {
+            THEN("return a new either in error wrapping its error") {
+                types::either<std::string, error> lifted = lift(repeat)(
+                    types::either<std::string, error>{std::string{"ab"}}, types::either<int, error>{error{404}});
+                CHECK(lifted == types::either<std::string, error>{error{404}});
+            }
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#include <absent/adapters/either/and_then.h>
+#include <absent/adapters/either/memoize.h>
+
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::adapters::either;
+
+SCENARIO("memoize provides a way to cache the results of an unary function returning either<B, E>",
+         "[either][memoize]") {
+
+    struct error {
+        int code;
+
+        bool operator==(error const &rhs) const {
+            return code == rhs.code;
+        }
+    };
+
+    auto calls = 0;
+    auto const find_name = [&calls](int id) -> types::either<std::string, error> {
+        ++calls;
+        if (id < 0) {
+            return error{404};
+        }
+        return "user " + std::to_string(id);
+    };
+
+    GIVEN("A memoized function called twice with a key whose result is not in error") {
+
+        auto const memoized = memoize<int>(find_name);
+
+        THEN("call the function once") {
+            CHECK((types::either<int, error>{42} >> memoized) == types::either<std::string, error>{"user 42"});
+            CHECK((types::either<int, error>{42} >> memoized) == types::either<std::string, error>{"user 42"});
+            CHECK(calls == 1);
+        }
+    }
+
+    GIVEN("A memoized function called twice with a key whose result is in error") {
+
+        WHEN("errors are cached") {
+            auto const memoized = memoize<int>(find_name);
+
+            THEN("call the function once, and return the cached error") {
+                CHECK(memoized(-1) == types::either<std::string, error>{error{404}});
+                CHECK(memoized(-1) == types::either<std::string, error>{error{404}});
+                CHECK(calls == 1);
+            }
+        }
+
+        WHEN("errors are not cached") {
+            auto options = memoize_options{};
+            options.cache_failures = false;
+            auto const memoized = memoize<int>(find_name, options);
+
+            THEN("call the function each time") {
+                CHECK(memoized(-1) == types::either<std::string, error>{error{404}});
+                CHECK(memoized(-1) == types::either<std::string, error>{error{404}});
+                CHECK(calls == 2);
+                CHECK(memoized.statistics().misses == 2);
+            }
+        }
+    }
+}
@@ -0,0 +1,73 @@
+#include <absent/adapters/either/and_then.h>
+#include <absent/adapters/either/parsing.h>
+
+#include <array>
+#include <charconv>
+#include <string_view>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::adapters::either;
+using namespace std::string_view_literals;
+
+SCENARIO("parsers for either<A, error> keep the reason of a failure", "[either][parsing]") {
+
+    GIVEN("A parser for int") {
+
+        auto const to_int = parsing::integer<int>();
+
+        THEN("return the integer, or the reason of the failure") {
+            CHECK(*to_int("42") == 42);
+            CHECK(to_int("abc").error() == parsing::error::invalid_number);
+            CHECK(to_int("99999999999").error() == parsing::error::out_of_range);
+            CHECK(to_int("42abc").error() == parsing::error::trailing_characters);
+        }
+    }
+
+    GIVEN("A parser for double") {
+
+        auto const to_double = parsing::floating<double>(std::chars_format::fixed);
+
+        THEN("return the number, or the reason of the failure") {
+            CHECK(*to_double("2.5") == 2.5);
+            CHECK(to_double("").error() == parsing::error::invalid_number);
+            CHECK(to_double("2.5e2").error() == parsing::error::trailing_characters);
+        }
+    }
+
+    GIVEN("A record of three fields") {
+
+        auto const record = "42,3.5,joe"sv;
+
+        THEN("return the fields, or the reason of the failure") {
+            CHECK(*parsing::field(2)(record) == "joe"sv);
+            CHECK(parsing::field(3)(record).error() == parsing::error::missing_field);
+            CHECK(*parsing::fields<3>()(record) == std::array{"42"sv, "3.5"sv, "joe"sv});
+            CHECK(parsing::fields<4>()(record).error() == parsing::error::missing_field);
+            CHECK(parsing::fields<2>()(record).error() == parsing::error::trailing_characters);
+        }
+    }
+
+    GIVEN("A key/value pair") {
+
+        THEN("return the key and the value, or the reason of the failure") {
+            CHECK(*parsing::key_value()("timeout=30"sv) == std::pair{"timeout"sv, "30"sv});
+            CHECK(parsing::key_value()("timeout"sv).error() == parsing::error::missing_separator);
+        }
+    }
+
+    GIVEN("A pipeline of parsers") {
+
+        auto const quantity_of = [](std::string_view line) {
+            return parsing::field(1, ';')(line) >> parsing::integer<int>();
+        };
+
+        THEN("short-circuit on the first failure") {
+            CHECK(*quantity_of("apple;3") == 3);
+            CHECK(quantity_of("apple").error() == parsing::error::missing_field);
+            CHECK(quantity_of("apple;three").error() == parsing::error::invalid_number);
+        }
+    }
+}
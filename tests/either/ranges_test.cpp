@@ -0,0 +1,66 @@
+#include <absent/adapters/either/ranges.h>
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::adapters::either;
+
+SCENARIO("the views work for ranges of either<A, E>", "[either][ranges]") {
+
+    struct error {
+        int code;
+
+        bool operator==(error const &rhs) const {
+            return code == rhs.code;
+        }
+    };
+
+    GIVEN("A vector<either<int, E>>") {
+
+        auto const eithers =
+            std::vector<types::either<int, error>>{types::either<int, error>{1}, types::either<int, error>{error{404}},
+                                                   types::either<int, error>{3}, types::either<int, error>{error{500}}};
+
+        WHEN("viewing its values") {
+
+            THEN("skip the ones in error") {
+                auto values = std::vector<int>{};
+                for (auto const value : eithers | views::present()) {
+                    values.push_back(value);
+                }
+                CHECK(values == std::vector{1, 3});
+            }
+        }
+
+        WHEN("viewing its errors") {
+
+            THEN("skip the ones not in error") {
+                auto codes = std::vector<int>{};
+                for (auto const &e : eithers | views::errors()) {
+                    codes.push_back(e.code);
+                }
+                CHECK(codes == std::vector{404, 500});
+            }
+        }
+
+        WHEN("viewing the results of a function returning either<B, E>") {
+
+            THEN("skip the ones in error") {
+                auto const describe = [](int x) -> types::either<std::string, error> {
+                    if (x > 1) {
+                        return std::to_string(x);
+                    }
+                    return error{400};
+                };
+                auto descriptions = std::vector<std::string>{};
+                for (auto &description : eithers | views::present() | views::and_then_each(describe)) {
+                    descriptions.push_back(std::move(description));
+                }
+                CHECK(descriptions == std::vector<std::string>{"3"});
+            }
+        }
+    }
+}
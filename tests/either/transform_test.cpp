@@ -1,5 +1,7 @@
 #include <absent/adapters/either/transform.h>
 
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <utility>
 
@@ -75,4 +77,45 @@ SCENARIO("transform provides a way to map {either<A, E>, f: A -> B} to either<B,
             }
         }
     }
+
+    GIVEN("A function unique_ptr<int> -> int that takes ownership of its argument") {
+
+        auto release = [](std::unique_ptr<int> p) { return *p; };
+
+        AND_GIVEN("An rvalue either<unique_ptr<int>, unique_ptr<Error>>") {
+
+            using either_ptr = either<std::unique_ptr<int>, std::unique_ptr<Error>>;
+
+            WHEN("invalid") {
+                THEN("move the error into a new invalid either<int, unique_ptr<Error>>") {
+                    either<int, std::unique_ptr<Error>> mapped_invalid =
+                        either_ptr{std::make_unique<Error>("404")} | release;
+                    CHECK(*mapped_invalid.error() == Error{"404"});
+                }
+            }
+
+            WHEN("valid") {
+                THEN("move the wrapped value into the function and return a valid and mapped either<int, Error>") {
+                    either<int, std::unique_ptr<Error>> mapped_valid = either_ptr{std::make_unique<int>(200)} | release;
+                    CHECK(*mapped_valid == 200);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("transform copies an allocator-aware error with its allocator", "[either-transform]") {
+
+    GIVEN("An either<int, pmr::string> in error allocated in an arena") {
+
+        std::pmr::monotonic_buffer_resource arena;
+        either<int, std::pmr::string> const invalid{std::allocator_arg, std::pmr::polymorphic_allocator<char>{&arena},
+                                                    rvarago::absent::adapters::types::in_place_error, "404"};
+
+        THEN("allocate the copy of the error in the same arena") {
+            auto const mapped = transform(invalid, [](int x) { return x + 1; });
+            CHECK(mapped.error() == "404");
+            CHECK(mapped.error().get_allocator().resource() == &arena);
+        }
+    }
 }
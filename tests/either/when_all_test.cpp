@@ -0,0 +1,39 @@
+#include <absent/adapters/either/when_all.h>
+#include <absent/support/work_stealing_pool.h>
+
+#include <string>
+#include <tuple>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::adapters::either;
+
+SCENARIO("when_all provides a way to run nullary functions returning either<A, E> concurrently", "[either][when_all]") {
+
+    enum class error { forbidden };
+
+    support::work_stealing_pool pool{2};
+
+    auto const profile = [] { return types::either<std::string, error>{std::string{"profile"}}; };
+    auto const quota = [] { return types::either<int, error>{42}; };
+
+    GIVEN("Functions that all return eithers not in error") {
+
+        THEN("return a future of an either wrapping the tuple of their values") {
+            auto all = when_all(pool, profile, quota).get();
+            CHECK(all == types::either<std::tuple<std::string, int>, error>{std::tuple{std::string{"profile"}, 42}});
+        }
+    }
+
+    GIVEN("A function that returns an either in error") {
+
+        auto const permissions = [] { return types::either<bool, error>{error::forbidden}; };
+
+        THEN("return a future of an either in error wrapping the same error") {
+            auto all = when_all(pool, profile, permissions, quota).get();
+            CHECK(all == types::either<std::tuple<std::string, bool, int>, error>{error::forbidden});
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#include <absent/adapters/either/and_then.h>
+#include <absent/adapters/either/fuse.h>
+#include <absent/adapters/either/within.h>
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+#include <catch2/catch.hpp>
+
+#include "../manual_clock.h"
+
+namespace support = rvarago::absent::support;
+using rvarago::absent::tests::manual_clock;
+using namespace rvarago::absent::adapters::either;
+using rvarago::absent::adapters::types::either;
+
+namespace {
+
+using deadline = support::basic_deadline<manual_clock>;
+
+template <typename Deadline, typename = void>
+struct is_within_viable : std::false_type {};
+
+template <typename Deadline>
+struct is_within_viable<Deadline, std::void_t<decltype(within(std::declval<Deadline>(), std::declval<int (*)(int)>()))>>
+    : std::true_type {};
+
+struct not_found final {
+    bool operator==(not_found const &) const {
+        return true;
+    }
+};
+
+using error = std::variant<not_found, support::deadline_exceeded>;
+
+}
+
+SCENARIO("within provides a way to fail the stages of a pipeline of either<A, E> once a deadline expires",
+         "[either][within]") {
+
+    manual_clock::current = manual_clock::time_point{};
+    auto const budget = deadline::after(std::chrono::milliseconds{100});
+
+    auto calls = 0;
+    auto const find_person = [&calls](int id) -> either<std::string, error> {
+        ++calls;
+        manual_clock::current += std::chrono::milliseconds{60};
+        if (id < 0) {
+            return error{not_found{}};
+        }
+        return std::to_string(id);
+    };
+    auto const find_address = [&calls](std::string const &person) -> either<std::string, error> {
+        ++calls;
+        manual_clock::current += std::chrono::milliseconds{60};
+        return person + "'s address";
+    };
+
+    GIVEN("A pipeline whose stages fit in the budget") {
+
+        THEN("run all the stages") {
+            CHECK((either<int, error>{42} >> within(budget, find_person)) == either<std::string, error>{"42"});
+            CHECK(calls == 1);
+        }
+    }
+
+    GIVEN("A pipeline whose budget is spent by a stage") {
+
+        THEN("skip the remaining stages, and return deadline_exceeded") {
+            auto const output = either<int, error>{42} >> within(budget, find_person) >>
+                                within(budget, find_address) >> within(budget, find_address);
+            CHECK(output == either<std::string, error>{error{support::deadline_exceeded{}}});
+            CHECK(calls == 2);
+        }
+    }
+
+    GIVEN("A stage that fails before the deadline") {
+
+        THEN("tell its error apart from a timeout") {
+            CHECK((either<int, error>{-1} >> within(budget, find_person)) ==
+                  either<std::string, error>{error{not_found{}}});
+        }
+    }
+
+    GIVEN("A temporary deadline") {
+
+        THEN("reject it, since the returned function would outlive it") {
+            STATIC_REQUIRE(is_within_viable<deadline const &>::value);
+            STATIC_REQUIRE_FALSE(is_within_viable<deadline>::value);
+            STATIC_REQUIRE_FALSE(is_within_viable<deadline const>::value);
+        }
+    }
+
+    GIVEN("A stage of transform, which returns a plain value") {
+
+        auto const twice = [&calls](int x) {
+            ++calls;
+            return x * 2;
+        };
+
+        THEN("fail with deadline_exceeded once the deadline has expired") {
+            manual_clock::current += std::chrono::milliseconds{100};
+            auto const result = either<int, error>{21} >> transform_within<error>(budget, twice);
+            REQUIRE_FALSE(result.has_value());
+            CHECK(std::holds_alternative<support::deadline_exceeded>(result.error()));
+            CHECK(calls == 0);
+        }
+
+        THEN("run it while the deadline has not expired") {
+            CHECK((either<int, error>{21} >> transform_within<error>(budget, twice)) == either<int, error>{42});
+            CHECK(calls == 1);
+        }
+    }
+
+    GIVEN("absent::within, which returns an empty nullable once the deadline has expired") {
+
+        THEN("reject an either, which can't be empty without an error, rather than succeed with a default value") {
+            STATIC_REQUIRE(rvarago::absent::detail::is_fusable_v<either<int, error>>);
+            STATIC_REQUIRE_FALSE(rvarago::absent::detail::has_empty_v<either<int, error>>);
+            STATIC_REQUIRE(rvarago::absent::detail::has_empty_v<std::optional<int>>);
+        }
+    }
+}
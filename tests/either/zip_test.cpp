@@ -0,0 +1,43 @@
+#include <absent/adapters/either/zip.h>
+
+#include <string>
+#include <tuple>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::adapters::either;
+
+SCENARIO("zip provides a way to combine several either<A, E> into an either<tuple<A...>, E>", "[either][zip]") {
+
+    struct error {
+        int code;
+
+        bool operator==(error const &rhs) const {
+            return code == rhs.code;
+        }
+    };
+
+    GIVEN("An either<int, E> and an either<string, E>") {
+
+        types::either<int, error> const valid_int{42};
+        types::either<std::string, error> const valid_string{std::string{"42"}};
+
+        WHEN("none is in error") {
+            THEN("return a new either wrapping the tuple of their values") {
+                types::either<std::tuple<int, std::string>, error> zipped = zip(valid_int, valid_string);
+                CHECK(zipped == types::either<std::tuple<int, std::string>, error>{std::tuple{42, std::string{"42"}}});
+            }
+        }
+
+        WHEN("both are in error") {
+            types::either<int, error> const invalid_int{error{400}};
+            types::either<std::string, error> const invalid_string{error{404}};
+
+            THEN("return a new either in error wrapping the first error") {
+                types::either<std::tuple<int, std::string>, error> zipped = zip(invalid_int, invalid_string);
+                CHECK(zipped == types::either<std::tuple<int, std::string>, error>{error{400}});
+            }
+        }
+    }
+}
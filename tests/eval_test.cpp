@@ -1,5 +1,6 @@
 #include <absent/eval.h>
 
+#include <memory>
 #include <optional>
 
 #include <catch2/catch.hpp>
@@ -30,4 +31,23 @@ SCENARIO("eval provides a way to lazily go from optional<A> to A", "[eval]") {
             }
         }
     }
-}
\ No newline at end of file
+
+    GIVEN("An rvalue optional<unique_ptr<int>>") {
+
+        auto to_minus_one = [] { return std::make_unique<int>(-1); };
+
+        WHEN("empty") {
+            THEN("return the result of calling the fallback function") {
+                std::unique_ptr<int> value = eval(std::optional<std::unique_ptr<int>>{}, to_minus_one);
+                CHECK(*value == -1);
+            }
+        }
+
+        WHEN("not empty") {
+            THEN("move the wrapped value out") {
+                std::unique_ptr<int> value = eval(std::optional{std::make_unique<int>(1)}, to_minus_one);
+                CHECK(*value == 1);
+            }
+        }
+    }
+}
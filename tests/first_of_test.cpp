@@ -0,0 +1,147 @@
+#include <absent/first_of.h>
+#include <absent/support/thread_pool.h>
+#include <absent/support/work_stealing_pool.h>
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+SCENARIO("first_of provides a way to try nullary functions returning optional<A> in order", "[first_of]") {
+
+    auto calls = 0;
+    auto const miss = [&calls] {
+        ++calls;
+        return std::optional<std::string>{};
+    };
+    auto const hit = [&calls] {
+        ++calls;
+        return std::optional<std::string>{"replica"};
+    };
+
+    GIVEN("Functions where one returns a non-empty optional") {
+
+        THEN("return it, without calling the remaining functions") {
+            CHECK(first_of(miss, hit, miss) == std::optional<std::string>{"replica"});
+            CHECK(calls == 2);
+        }
+    }
+
+    GIVEN("Functions that all return empty optionals") {
+
+        THEN("return an empty optional, after calling all of them") {
+            CHECK(first_of(miss, miss, miss) == std::nullopt);
+            CHECK(calls == 3);
+        }
+    }
+
+    GIVEN("A single function") {
+
+        THEN("return its result") {
+            CHECK(first_of(hit) == std::optional<std::string>{"replica"});
+            CHECK(first_of(miss) == std::nullopt);
+        }
+    }
+}
+
+SCENARIO("first_of provides a way to hedge nullary functions returning optional<A> on an executor", "[first_of]") {
+
+    support::work_stealing_pool pool{4};
+
+    GIVEN("A primary function that returns a non-empty optional before the delay") {
+
+        std::atomic<int> replica_calls{0};
+        auto const primary = [] { return std::optional<std::string>{"primary"}; };
+        auto const replica = [&replica_calls] {
+            ++replica_calls;
+            return std::optional<std::string>{"replica"};
+        };
+
+        THEN("return a future of its result, without launching the remaining functions") {
+            CHECK(first_of(pool, std::chrono::hours{1}, primary, replica).get() ==
+                  std::optional<std::string>{"primary"});
+            CHECK(replica_calls == 0);
+        }
+    }
+
+    GIVEN("A primary function that is slower than the delay") {
+
+        std::atomic<bool> is_cancelled{false};
+        auto const primary = [&is_cancelled](support::cancellation_token const &token) {
+            while (!token.is_cancelled()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            }
+            is_cancelled = true;
+            return std::optional<std::string>{"primary"};
+        };
+        auto const replica = [] { return std::optional<std::string>{"replica"}; };
+
+        THEN("launch the next function once the delay has passed, return its result, and cancel the primary") {
+            CHECK(first_of(pool, std::chrono::milliseconds{5}, primary, replica).get() ==
+                  std::optional<std::string>{"replica"});
+
+            while (!is_cancelled) {
+                std::this_thread::yield();
+            }
+            CHECK(is_cancelled);
+        }
+    }
+
+    GIVEN("A primary function that returns an empty optional") {
+
+        auto const primary = [] { return std::optional<std::string>{}; };
+        auto const replica = [] { return std::optional<std::string>{"replica"}; };
+
+        THEN("launch the next function without waiting for the delay") {
+            auto const start = std::chrono::steady_clock::now();
+            CHECK(first_of(pool, std::chrono::hours{1}, primary, replica).get() ==
+                  std::optional<std::string>{"replica"});
+            CHECK(std::chrono::steady_clock::now() - start < std::chrono::minutes{1});
+        }
+    }
+
+    GIVEN("An executor with a single thread and a primary function that returns a non-empty optional at once") {
+
+        auto single = support::thread_pool{1};
+        auto const primary = [] { return std::optional<int>{42}; };
+        auto const replica = [] { return std::optional<int>{7}; };
+
+        THEN("return a future of its result without a thread of the executor waiting for the delay") {
+            auto const start = std::chrono::steady_clock::now();
+            CHECK(first_of(single, std::chrono::milliseconds{100}, primary, replica, replica).get() ==
+                  std::optional<int>{42});
+            CHECK(std::chrono::steady_clock::now() - start < std::chrono::milliseconds{100});
+        }
+    }
+
+    GIVEN("Functions that all return empty optionals") {
+
+        std::atomic<int> calls{0};
+        auto const miss = [&calls] {
+            ++calls;
+            return std::optional<int>{};
+        };
+
+        THEN("return a future of an empty optional, after launching all of them") {
+            CHECK(first_of(pool, std::chrono::milliseconds{1}, miss, miss, miss).get() == std::nullopt);
+            CHECK(calls == 3);
+        }
+    }
+
+    GIVEN("A function that throws an exception") {
+
+        auto const failing = []() -> std::optional<int> { throw std::runtime_error{"503"}; };
+        auto const replica = [] { return std::optional<int>{42}; };
+
+        THEN("return a future that rethrows the exception") {
+            auto first = first_of(pool, std::chrono::hours{1}, failing, replica);
+            CHECK_THROWS_AS(first.get(), std::runtime_error);
+        }
+    }
+}
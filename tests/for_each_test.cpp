@@ -1,5 +1,6 @@
 #include <absent/for_each.h>
 
+#include <memory>
 #include <optional>
 
 #include <catch2/catch.hpp>
@@ -33,4 +34,26 @@ SCENARIO("for_each provides a way to perform a side-effect in the value wrapped
             }
         }
     }
+
+    GIVEN("An rvalue optional<unique_ptr<int>>") {
+
+        int counter = 0;
+        auto add_counter = [&counter](std::unique_ptr<int> p) { counter += *p; };
+
+        WHEN("empty") {
+            THEN("do nothing") {
+                for_each(std::optional<std::unique_ptr<int>>{}, add_counter);
+
+                CHECK(counter == 0);
+            }
+        }
+
+        WHEN("not empty") {
+            THEN("move the wrapped value into the action to perform the side-effect of incrementing the counter") {
+                for_each(std::optional{std::make_unique<int>(1)}, add_counter);
+
+                CHECK(counter == 1);
+            }
+        }
+    }
 }
@@ -1,6 +1,11 @@
+#include <absent/eval.h>
 #include <absent/support/from_variant.h>
 
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 #include <catch2/catch.hpp>
 
@@ -33,3 +38,115 @@ SCENARIO("from_variant provides a way to go from a variant<Rest..> to optional<A
         }
     }
 }
+
+SCENARIO("from_variant copies or moves only the selected alternative", "[from_variant]") {
+
+    GIVEN("A variant<unique_ptr<int>, string> holding a move-only alternative") {
+
+        std::variant<std::unique_ptr<int>, std::string> variant = std::make_unique<int>(42);
+
+        WHEN("moved into from_variant") {
+            auto some = from_variant<std::unique_ptr<int>>(std::move(variant));
+
+            THEN("move the value out of it") {
+                CHECK(**some == 42);
+            }
+        }
+    }
+}
+
+SCENARIO("from_variant_ref provides a way to go from a variant<Rest..> to optional_ref<A>", "[from_variant]") {
+
+    GIVEN("A variant<int, string>") {
+
+        std::variant<int, std::string> variant = std::string{"404"};
+
+        WHEN("in the expected string alternative") {
+
+            auto const some = from_variant_ref<std::string>(variant);
+
+            THEN("refer to the value held by the variant") {
+                CHECK(&*some == std::get_if<std::string>(&variant));
+            }
+
+            AND_WHEN("modifying it via the reference") {
+                *some = "200";
+
+                THEN("modify the value held by the variant") {
+                    CHECK(std::get<std::string>(variant) == "200");
+                }
+            }
+        }
+
+        WHEN("chaining the optional_ref into eval") {
+
+            THEN("copy the value held by the variant, and leave it untouched") {
+                CHECK(eval(from_variant_ref<std::string>(variant), [] { return std::string{"fallback"}; }) == "404");
+                CHECK(std::get<std::string>(variant) == "404");
+            }
+        }
+
+        WHEN("in the unexpected alternative") {
+
+            THEN("return an empty optional_ref") {
+                CHECK_FALSE(from_variant_ref<int>(variant).has_value());
+            }
+        }
+
+        WHEN("const") {
+
+            auto const &const_variant = variant;
+
+            THEN("return an optional_ref to const") {
+                STATIC_REQUIRE(std::is_same_v<decltype(from_variant_ref<std::string>(const_variant)),
+                                              support::optional_ref<std::string const>>);
+                CHECK(*from_variant_ref<std::string>(const_variant) == "404");
+            }
+        }
+    }
+}
+
+SCENARIO("project_variant narrows a variant<Rest...> into optional<variant<As...>>", "[from_variant]") {
+
+    struct ping final {
+        int sequence;
+    };
+    struct pong final {
+        int sequence;
+    };
+    struct shutdown final {};
+
+    using message = std::variant<ping, std::string, pong, shutdown>;
+
+    GIVEN("A variant holding one of the requested alternatives") {
+
+        message const pinged = ping{1};
+        message const ponged = pong{2};
+
+        THEN("return the narrower variant holding it") {
+            auto const projected_ping = project_variant<pong, ping>(pinged);
+            auto const projected_pong = project_variant<pong, ping>(ponged);
+            STATIC_REQUIRE(std::is_same_v<decltype(projected_ping), std::optional<std::variant<pong, ping>> const>);
+            CHECK(std::get<ping>(*projected_ping).sequence == 1);
+            CHECK(std::get<pong>(*projected_pong).sequence == 2);
+        }
+    }
+
+    GIVEN("A variant holding none of the requested alternatives") {
+
+        THEN("return an empty optional") {
+            CHECK(project_variant<pong, ping>(message{shutdown{}}) == std::nullopt);
+            CHECK(project_variant<pong, ping>(message{std::string{"hello"}}) == std::nullopt);
+        }
+    }
+
+    GIVEN("An rvalue variant holding a requested alternative") {
+
+        THEN("move the value out of it") {
+            auto projected = project_variant<std::unique_ptr<int>>(
+                std::variant<int, std::unique_ptr<int>>{std::make_unique<int>(42)});
+            CHECK(*std::get<std::unique_ptr<int>>(*projected) == 42);
+        }
+    }
+}
+
@@ -0,0 +1,105 @@
+#include <absent/fuse.h>
+
+#include <optional>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+SCENARIO("fuse provides a way to build a deferred pipeline run on {optional<A>} as a single function", "[fuse]") {
+
+    GIVEN("A pipeline made of a function int -> optional<int> followed by a function int -> string") {
+
+        int halve_calls = 0;
+        auto halve = [&halve_calls](int x) -> std::optional<int> {
+            ++halve_calls;
+            return x % 2 == 0 ? std::optional{x / 2} : std::nullopt;
+        };
+
+        int to_string_calls = 0;
+        auto to_string = [&to_string_calls](int x) -> std::string {
+            ++to_string_calls;
+            return std::to_string(x);
+        };
+
+        auto const pipeline = fuse() >> halve | to_string;
+
+        AND_GIVEN("An optional<int>") {
+
+            WHEN("empty") {
+                std::optional<int> none;
+
+                THEN("return a new empty optional<string> without evaluating any stage") {
+                    std::optional<std::string> result_none = none | pipeline;
+                    CHECK(result_none == std::nullopt);
+                    CHECK(halve_calls == 0);
+                    CHECK(to_string_calls == 0);
+                }
+            }
+
+            WHEN("not empty but a stage returns an empty optional") {
+                std::optional<int> odd{201};
+
+                THEN("return a new empty optional<string> without evaluating the remaining stages") {
+                    std::optional<std::string> result_none = run(odd, pipeline);
+                    CHECK(result_none == std::nullopt);
+                    CHECK(halve_calls == 1);
+                    CHECK(to_string_calls == 0);
+                }
+            }
+
+            WHEN("not empty and every stage succeeds") {
+                std::optional<int> even{400};
+
+                THEN("return a non-empty optional<string> with the result of all stages") {
+                    std::optional<std::string> result_some = even | pipeline;
+                    CHECK(result_some == std::optional{std::string{"200"}});
+                    CHECK(halve_calls == 1);
+                    CHECK(to_string_calls == 1);
+                }
+            }
+        }
+    }
+
+    GIVEN("A pipeline whose last stage is a function int -> optional<int>") {
+
+        auto increment = [](int x) { return x + 1; };
+        auto halve = [](int x) -> std::optional<int> { return x % 2 == 0 ? std::optional{x / 2} : std::nullopt; };
+
+        auto const pipeline = (fuse() | increment) >> halve >> halve;
+
+        AND_GIVEN("An optional<int>") {
+
+            WHEN("not empty") {
+                std::optional<int> some{3};
+
+                THEN("return the same as the equivalent eager chain") {
+                    std::optional<int> result_some = some | pipeline;
+                    CHECK(result_some == std::optional{1});
+                }
+            }
+        }
+    }
+
+    GIVEN("A pipeline made of a member function Person -> string") {
+
+        struct Person {
+            std::string id() const {
+                return std::string{"200"};
+            }
+        };
+
+        auto const pipeline = fuse() | &Person::id;
+
+        AND_GIVEN("An rvalue optional<Person>") {
+
+            WHEN("not empty") {
+                THEN("return a non-empty optional<string>") {
+                    std::optional<std::string> result_some = std::optional{Person{}} | pipeline;
+                    CHECK(result_some == std::optional{std::string{"200"}});
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#include <absent/support/future.h>
+
+#include <exception>
+#include <future>
+#include <stdexcept>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+SCENARIO("future provides the value set by the corresponding promise", "[future]") {
+
+    GIVEN("A promise<int> and its future") {
+
+        support::promise<int> promise;
+        auto future = promise.get_future();
+
+        WHEN("satisfied with a value") {
+            promise.set_value(42);
+
+            THEN("provide the value") {
+                CHECK(future.is_ready());
+                CHECK(future.get() == 42);
+                CHECK_FALSE(future.valid());
+            }
+        }
+
+        WHEN("satisfied with an exception") {
+            promise.set_exception(std::make_exception_ptr(std::runtime_error{"404"}));
+
+            THEN("rethrow the exception") {
+                CHECK_THROWS_AS(future.get(), std::runtime_error);
+            }
+        }
+
+        WHEN("subscribed before being satisfied") {
+            int received = 0;
+            std::move(future).subscribe([&received](support::future<int> ready) { received = ready.get(); });
+
+            THEN("call the continuation once satisfied") {
+                CHECK(received == 0);
+                promise.set_value(42);
+                CHECK(received == 42);
+            }
+        }
+    }
+
+    GIVEN("A promise<int> destroyed without being satisfied") {
+
+        auto future = support::promise<int>{}.get_future();
+
+        THEN("make the future rethrow a broken promise error") {
+            CHECK_THROWS_AS(future.get(), std::future_error);
+        }
+    }
+}
@@ -0,0 +1,34 @@
+// Instrumentation is enabled in this translation unit only, whereas the others of the executable are built without it.
+#define RVARAGO_ABSENT_INSTRUMENTATION
+
+#include <absent/and_then.h>
+#include <absent/instrumentation.h>
+
+#include <algorithm>
+#include <optional>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+SCENARIO("instrumentation may be enabled in some translation units only", "[instrumentation]") {
+
+    GIVEN("A function int -> optional<int> named in a translation unit where instrumentation is enabled") {
+
+        auto const half = instrumentation::named("mixed/half", [](int x) -> std::optional<int> {
+            return x % 2 == 0 ? std::optional{x / 2} : std::nullopt;
+        });
+
+        THEN("record its counters, without conflicting with the translation units where it's disabled") {
+            STATIC_REQUIRE(detail::is_instrumented_v<std::decay_t<decltype(half)>>);
+            CHECK((std::optional{4} >> half) == std::optional{2});
+
+            auto const all = instrumentation::statistics();
+            auto const found = std::find_if(all.cbegin(), all.cend(),
+                                            [](auto const &stage) { return stage.name == "mixed/half"; });
+            REQUIRE(found != all.cend());
+            CHECK(found->taken == 1);
+        }
+    }
+}
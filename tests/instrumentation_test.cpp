@@ -0,0 +1,275 @@
+#include <absent/and_then.h>
+#include <absent/for_each.h>
+#include <absent/instrumentation.h>
+#include <absent/transform.h>
+
+#include <absent/adapters/either/and_then.h>
+#include <absent/adapters/either/either.h>
+#include <absent/adapters/either/transform.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+#ifndef RVARAGO_ABSENT_INSTRUMENTATION
+
+SCENARIO("named and timed are no-ops unless instrumentation is enabled", "[instrumentation]") {
+
+    GIVEN("A function int -> optional<int>") {
+
+        auto const half = [](int x) -> std::optional<int> {
+            return x % 2 == 0 ? std::optional{x / 2} : std::nullopt;
+        };
+
+        WHEN("it's named") {
+            auto const stage = instrumentation::named("half", half);
+
+            THEN("return the function itself, hence add no overhead") {
+                static_assert(std::is_same_v<std::decay_t<decltype(stage)>, std::decay_t<decltype(half)>>);
+                static_assert(!detail::is_instrumented_v<std::decay_t<decltype(stage)>>);
+                CHECK((std::optional{4} >> stage) == std::optional{2});
+            }
+        }
+
+        WHEN("it's timed") {
+            auto const stage = instrumentation::timed("half", half);
+
+            THEN("return the function itself, hence add no overhead") {
+                static_assert(std::is_same_v<std::decay_t<decltype(stage)>, std::decay_t<decltype(half)>>);
+            }
+        }
+
+        WHEN("it's named with a stage_id") {
+            auto const stage = instrumentation::named(instrumentation::stage_id{"half"}, half);
+
+            THEN("return the function itself, hence add no overhead") {
+                static_assert(std::is_same_v<std::decay_t<decltype(stage)>, std::decay_t<decltype(half)>>);
+                static_assert(std::is_empty_v<instrumentation::stage_id>);
+            }
+        }
+
+        WHEN("statistics are requested") {
+            auto const unused = std::optional{4} >> instrumentation::named("half", half);
+            (void)unused;
+
+            THEN("return nothing") {
+                CHECK(instrumentation::statistics().empty());
+            }
+        }
+    }
+}
+
+#else
+
+namespace {
+
+auto statistics_of(std::string const &name) -> instrumentation::stage_statistics {
+    auto const all = instrumentation::statistics();
+    auto const found =
+        std::find_if(all.cbegin(), all.cend(), [&name](auto const &stage) { return stage.name == name; });
+    return found == all.cend() ? instrumentation::stage_statistics{name} : *found;
+}
+
+class recording_sink final : public instrumentation::metrics_sink {
+  public:
+    std::vector<instrumentation::stage_statistics> recorded;
+
+    auto record(instrumentation::stage_statistics const &statistics) -> void override {
+        recorded.push_back(statistics);
+    }
+};
+
+}
+
+SCENARIO("named records how stages of a chain behave", "[instrumentation]") {
+
+    GIVEN("A function int -> optional<int> named half") {
+
+        auto const half = instrumentation::named("named/half", [](int x) -> std::optional<int> {
+            return x % 2 == 0 ? std::optional{x / 2} : std::nullopt;
+        });
+        auto const before = statistics_of("named/half");
+
+        WHEN("it's called with an empty optional") {
+            auto const result = std::optional<int>{} >> half;
+
+            THEN("count it as short-circuited") {
+                CHECK(result == std::nullopt);
+                auto const after = statistics_of("named/half");
+                CHECK(after.taken == before.taken);
+                CHECK(after.short_circuited == before.short_circuited + 1);
+                CHECK(after.failed == before.failed);
+            }
+        }
+
+        WHEN("it's called with odd and even values") {
+            auto const odd = std::optional{3} >> half;
+            auto const even = std::optional{4} >> half;
+
+            THEN("count both as taken and the odd one as failed") {
+                CHECK(odd == std::nullopt);
+                CHECK(even == std::optional{2});
+                auto const after = statistics_of("named/half");
+                CHECK(after.taken == before.taken + 2);
+                CHECK(after.short_circuited == before.short_circuited);
+                CHECK(after.failed == before.failed + 1);
+                CHECK(after.nanoseconds == 0);
+            }
+        }
+
+        WHEN("it's chained after a failing stage") {
+            auto const result = std::optional{6} >> half >> half >> half;
+
+            THEN("count the last call as short-circuited") {
+                CHECK(result == std::nullopt);
+                auto const after = statistics_of("named/half");
+                CHECK(after.taken == before.taken + 2);
+                CHECK(after.failed == before.failed + 1);
+                CHECK(after.short_circuited == before.short_circuited + 1);
+            }
+        }
+
+        WHEN("it's called from other threads") {
+            auto worker = std::thread{[&half] {
+                for (int i = 0; i < 10; ++i) {
+                    auto const unused = std::optional{i} >> half;
+                    (void)unused;
+                }
+            }};
+            worker.join();
+
+            THEN("aggregate their counters after they exit") {
+                auto const after = statistics_of("named/half");
+                CHECK(after.taken == before.taken + 10);
+                CHECK(after.failed == before.failed + 5);
+            }
+        }
+    }
+
+    GIVEN("A function named on every call with a stage_id resolved once") {
+
+        static instrumentation::stage_id const increment_id{"named/resolved_increment"};
+        auto const increment_all = [](int x) {
+            return std::optional{x} | instrumentation::named(increment_id, [](int y) { return y + 1; });
+        };
+        auto const before = statistics_of("named/resolved_increment");
+
+        WHEN("it's called a few times") {
+            CHECK(increment_all(1) == std::optional{2});
+            CHECK(increment_all(2) == std::optional{3});
+
+            THEN("share the counters of its name") {
+                auto const after = statistics_of("named/resolved_increment");
+                CHECK(after.taken == before.taken + 2);
+                CHECK(instrumentation::stage_id{"named/resolved_increment"}.value() == increment_id.value());
+            }
+        }
+    }
+
+    GIVEN("Functions named for transform and for_each") {
+
+        auto const increment = instrumentation::named("named/increment", [](int x) { return x + 1; });
+        auto sum = 0;
+        auto const accumulate = instrumentation::named("named/accumulate", [&sum](int x) { sum += x; });
+        auto const before_increment = statistics_of("named/increment");
+        auto const before_accumulate = statistics_of("named/accumulate");
+
+        WHEN("they are called with an empty and a non-empty optional") {
+            CHECK((std::optional<int>{} | increment) == std::nullopt);
+            CHECK((std::optional{1} | increment) == std::optional{2});
+            for_each(std::optional<int>{}, accumulate);
+            for_each(std::optional{1}, accumulate);
+
+            THEN("count one call as taken and the other as short-circuited") {
+                CHECK(sum == 1);
+                auto const after_increment = statistics_of("named/increment");
+                CHECK(after_increment.taken == before_increment.taken + 1);
+                CHECK(after_increment.short_circuited == before_increment.short_circuited + 1);
+                auto const after_accumulate = statistics_of("named/accumulate");
+                CHECK(after_accumulate.taken == before_accumulate.taken + 1);
+                CHECK(after_accumulate.short_circuited == before_accumulate.short_circuited + 1);
+            }
+        }
+    }
+
+    GIVEN("A function int -> either<int, string> named check") {
+
+        using adapters::types::either;
+        using adapters::either::operator>>;
+        using adapters::either::operator|;
+
+        auto const check = instrumentation::named("named/check", [](int x) -> either<int, std::string> {
+            if (x < 0) {
+                return std::string{"negative"};
+            }
+            return x;
+        });
+        auto const before = statistics_of("named/check");
+
+        WHEN("it's called with an error, a negative, and a positive value") {
+            CHECK((either<int, std::string>{std::string{"error"}} >> check).error() == "error");
+            CHECK((either<int, std::string>{-1} >> check).error() == "negative");
+            CHECK(*(either<int, std::string>{1} >> check) == 1);
+
+            THEN("count them as short-circuited, failed, and taken") {
+                auto const after = statistics_of("named/check");
+                CHECK(after.taken == before.taken + 2);
+                CHECK(after.short_circuited == before.short_circuited + 1);
+                CHECK(after.failed == before.failed + 1);
+            }
+        }
+    }
+}
+
+SCENARIO("timed also measures how long stages take", "[instrumentation]") {
+
+    GIVEN("A function int -> optional<int> timed slow") {
+
+        auto const slow = instrumentation::timed("timed/slow", [](int x) -> std::optional<int> {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            return x;
+        });
+        auto const before = statistics_of("timed/slow");
+
+        WHEN("it's called") {
+            CHECK((std::optional{1} >> slow) == std::optional{1});
+
+            THEN("add at least its duration") {
+                auto const after = statistics_of("timed/slow");
+                CHECK(after.taken == before.taken + 1);
+                CHECK(after.nanoseconds >= before.nanoseconds + 1'000'000);
+            }
+        }
+    }
+}
+
+SCENARIO("export_statistics sends the statistics of all named stages to a sink", "[instrumentation]") {
+
+    GIVEN("A named stage that has been called") {
+
+        auto const identity = instrumentation::named("export/identity", [](int x) { return std::optional{x}; });
+        auto const unused = std::optional{1} >> identity;
+        (void)unused;
+
+        WHEN("the statistics are exported") {
+            auto sink = recording_sink{};
+            instrumentation::export_statistics(sink);
+
+            THEN("record one entry per named stage") {
+                CHECK(sink.recorded.size() == instrumentation::statistics().size());
+                CHECK(std::any_of(sink.recorded.cbegin(), sink.recorded.cend(), [](auto const &stage) {
+                    return stage.name == "export/identity" && stage.taken > 0;
+                }));
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,74 @@
+#include <absent/support/invoke.h>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+SCENARIO("detail::invoke calls callables and pointers to members like std::invoke", "[invoke]") {
+
+    struct person final {
+        std::string name;
+
+        auto greet(std::string const &greeting) const -> std::string {
+            return greeting + ", " + name;
+        }
+
+        auto rename(std::string new_name) noexcept -> void {
+            name = std::move(new_name);
+        }
+    };
+
+    GIVEN("A callable object") {
+
+        auto const add = [](int x, int y) noexcept { return x + y; };
+
+        THEN("call it with the arguments, at compile-time too") {
+            STATIC_REQUIRE(detail::invoke(add, 1, 2) == 3);
+            STATIC_REQUIRE(noexcept(detail::invoke(add, 1, 2)));
+            CHECK(detail::invoke([](std::string const &s) { return s.size(); }, std::string{"42"}) == 2);
+        }
+    }
+
+    GIVEN("A pointer to a member function") {
+
+        person someone{"Joe"};
+
+        THEN("call it on an object, a pointer, or a smart pointer") {
+            CHECK(detail::invoke(&person::greet, someone, "Hi") == "Hi, Joe");
+            CHECK(detail::invoke(&person::greet, &someone, "Hello") == "Hello, Joe");
+            CHECK(detail::invoke(&person::greet, std::make_unique<person>(person{"Ann"}), "Hey") == "Hey, Ann");
+        }
+
+        THEN("propagate noexcept") {
+            STATIC_REQUIRE(noexcept(detail::invoke(&person::rename, someone, std::string{})));
+            STATIC_REQUIRE_FALSE(noexcept(detail::invoke(&person::greet, someone, "Hi")));
+        }
+
+        WHEN("it modifies the object") {
+            detail::invoke(&person::rename, someone, "Ann");
+
+            THEN("modify the very same object") {
+                CHECK(someone.name == "Ann");
+            }
+        }
+    }
+
+    GIVEN("A pointer to a data member") {
+
+        person someone{"Joe"};
+
+        THEN("return a reference of the same value category as the object") {
+            STATIC_REQUIRE(std::is_same_v<decltype(detail::invoke(&person::name, someone)), std::string &>);
+            STATIC_REQUIRE(
+                std::is_same_v<decltype(detail::invoke(&person::name, std::as_const(someone))), std::string const &>);
+            STATIC_REQUIRE(std::is_same_v<decltype(detail::invoke(&person::name, std::move(someone))), std::string &&>);
+            STATIC_REQUIRE(std::is_same_v<decltype(detail::invoke(&person::name, &someone)), std::string &>);
+            CHECK(&detail::invoke(&person::name, someone) == &someone.name);
+        }
+    }
+}
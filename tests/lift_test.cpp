@@ -0,0 +1,61 @@
+#include <absent/lift.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+SCENARIO("lift provides a way to apply a function of several arguments to several optional<A>", "[lift]") {
+
+    auto const concatenate = [](std::string const &prefix, int repetitions, std::string const &suffix) {
+        std::string result;
+        for (int i = 0; i < repetitions; ++i) {
+            result += prefix + suffix;
+        }
+        return result;
+    };
+
+    GIVEN("An optional<string>, an optional<int>, and another optional<string>") {
+
+        std::optional<std::string> const some_prefix{"a"};
+        std::optional<int> const some_repetitions{3};
+        std::optional<std::string> const some_suffix{"b"};
+
+        WHEN("none is empty") {
+            THEN("return a new optional wrapping the result of the function") {
+                std::optional<std::string> lifted = lift(concatenate)(some_prefix, some_repetitions, some_suffix);
+                CHECK(lifted == std::optional{std::string{"ababab"}});
+            }
+        }
+
+        WHEN("any is empty") {
+            THEN("return a new empty optional without calling the function") {
+                bool is_called = false;
+                auto const spy = [&is_called](std::string const &, int, std::string const &) {
+                    is_called = true;
+                    return std::string{};
+                };
+
+                std::optional<std::string> lifted = lift(spy)(some_prefix, std::optional<int>{}, some_suffix);
+                CHECK(lifted == std::nullopt);
+                CHECK_FALSE(is_called);
+            }
+        }
+    }
+
+    GIVEN("Large optional<vector<int>>") {
+
+        std::optional<std::vector<int>> const lhs{std::vector<int>(1024, 1)};
+        std::optional<std::vector<int>> const rhs{std::vector<int>(1024, 2)};
+
+        THEN("call the function with references to the wrapped values, without copying them") {
+            auto const same_addresses = lift([&](std::vector<int> const &l, std::vector<int> const &r) {
+                return &l == &*lhs && &r == &*rhs;
+            })(lhs, rhs);
+            CHECK(same_addresses == std::optional{true});
+        }
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef RVARAGO_ABSENT_TESTS_MANUALCLOCK_H
+#define RVARAGO_ABSENT_TESTS_MANUALCLOCK_H
+
+#include <chrono>
+
+namespace rvarago::absent::tests {
+
+/**
+ * A clock that only moves when a test advances it, and which counts how many times it's read.
+ */
+struct manual_clock final {
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<manual_clock>;
+
+    static constexpr bool is_steady = true;
+
+    static inline time_point current{};
+    static inline int reads = 0;
+
+    static auto now() noexcept -> time_point {
+        ++reads;
+        return current;
+    }
+};
+
+}
+
+#endif
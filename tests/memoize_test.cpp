@@ -0,0 +1,219 @@
+#include <absent/and_then.h>
+#include <absent/memoize.h>
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+SCENARIO("memoize provides a way to cache the results of an unary function returning optional<B>", "[memoize]") {
+
+    auto calls = std::make_shared<std::atomic<int>>(0);
+    auto const find_name = [calls](int id) -> std::optional<std::string> {
+        ++*calls;
+        if (id < 0) {
+            return std::nullopt;
+        }
+        return "user " + std::to_string(id);
+    };
+
+    GIVEN("A memoized function called twice with the same key") {
+
+        auto const memoized = memoize<int>(find_name);
+
+        THEN("call the function once, and return the cached result the second time") {
+            CHECK(memoized(42) == std::optional<std::string>{"user 42"});
+            CHECK(memoized(42) == std::optional<std::string>{"user 42"});
+            CHECK(*calls == 1);
+
+            auto const statistics = memoized.statistics();
+            CHECK(statistics.hits == 1);
+            CHECK(statistics.misses == 1);
+            CHECK(statistics.hit_rate() == 0.5);
+        }
+    }
+
+    GIVEN("A memoized function called twice with a key whose result is empty") {
+
+        WHEN("empty results are cached") {
+            auto const memoized = memoize<int>(find_name);
+
+            THEN("call the function once") {
+                CHECK(memoized(-1) == std::nullopt);
+                CHECK(memoized(-1) == std::nullopt);
+                CHECK(*calls == 1);
+            }
+        }
+
+        WHEN("empty results are not cached") {
+            auto options = memoize_options{};
+            options.cache_failures = false;
+            auto const memoized = memoize<int>(find_name, options);
+
+            THEN("call the function each time") {
+                CHECK(memoized(-1) == std::nullopt);
+                CHECK(memoized(-1) == std::nullopt);
+                CHECK(*calls == 2);
+            }
+        }
+    }
+
+    GIVEN("A memoized function whose results expire") {
+
+        auto options = memoize_options{};
+        options.ttl = std::chrono::hours{1};
+        options.failure_ttl = std::chrono::milliseconds{1};
+        auto const memoized = memoize<int>(find_name, options);
+
+        THEN("call the function again once an empty result expires, but not before a non-empty one does") {
+            CHECK(memoized(-1) == std::nullopt);
+            CHECK(memoized(42) == std::optional<std::string>{"user 42"});
+            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+            CHECK(memoized(-1) == std::nullopt);
+            CHECK(memoized(42) == std::optional<std::string>{"user 42"});
+            CHECK(*calls == 3);
+            CHECK(memoized.statistics().evictions == 1);
+        }
+    }
+
+    GIVEN("A memoized function with room for two results") {
+
+        auto options = memoize_options{};
+        options.capacity = 2;
+        options.shards = 1;
+
+        WHEN("the least recently used entry is evicted") {
+            options.policy = eviction::lru;
+            auto const memoized = memoize<int>(find_name, options);
+
+            THEN("keep the recently used entry") {
+                memoized(1);
+                memoized(2);
+                memoized(1);
+                memoized(3);
+                CHECK(*calls == 3);
+
+                memoized(1);
+                CHECK(*calls == 3);
+                memoized(2);
+                CHECK(*calls == 4);
+                CHECK(memoized.statistics().evictions == 2);
+            }
+        }
+
+        WHEN("the entries are evicted by a clock hand") {
+            options.policy = eviction::clock;
+            auto const memoized = memoize<int>(find_name, options);
+
+            THEN("keep the referenced entry") {
+                memoized(1);
+                memoized(2);
+                memoized(1);
+                memoized(3);
+                CHECK(*calls == 3);
+
+                memoized(1);
+                CHECK(*calls == 3);
+                memoized(2);
+                CHECK(*calls == 4);
+                CHECK(memoized.statistics().evictions == 2);
+            }
+        }
+
+        WHEN("unique keys are scanned without hits, and evicted by a clock hand") {
+            options.policy = eviction::clock;
+            auto const memoized = memoize<int>(find_name, options);
+
+            THEN("evict the oldest entry, rather than the newest one") {
+                memoized(1);
+                memoized(2);
+                memoized(3);
+                CHECK(*calls == 3);
+
+                memoized(2);
+                CHECK(*calls == 3);
+                memoized(1);
+                CHECK(*calls == 4);
+            }
+        }
+    }
+
+    GIVEN("A memoized function that has been cleared") {
+
+        auto const memoized = memoize<int>(find_name);
+        memoized(42);
+        memoized.clear();
+
+        THEN("call the function again") {
+            CHECK(memoized(42) == std::optional<std::string>{"user 42"});
+            CHECK(*calls == 2);
+        }
+    }
+
+    GIVEN("A memoized function passed to and_then") {
+
+        auto const memoized = memoize<int>(find_name);
+
+        THEN("cache the results across the pipelines") {
+            CHECK((std::optional{42} >> memoized) == std::optional<std::string>{"user 42"});
+            CHECK(and_then(std::optional{42}, memoized) == std::optional<std::string>{"user 42"});
+            CHECK(*calls == 1);
+        }
+    }
+}
+
+SCENARIO("memoize shares the computation across concurrent calls and doesn't cache exceptions", "[memoize]") {
+
+    GIVEN("A slow function called concurrently with the same key") {
+
+        auto calls = std::atomic<int>{0};
+        auto const memoized = memoize<int>([&calls](int id) {
+            ++calls;
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+            return std::optional{id * 2};
+        });
+
+        THEN("call the function once, and share its result") {
+            auto results = std::vector<std::optional<int>>(8);
+            auto threads = std::vector<std::thread>{};
+            for (std::size_t i = 0; i < results.size(); ++i) {
+                threads.emplace_back([&memoized, &results, i] { results[i] = memoized(21); });
+            }
+            for (auto &thread : threads) {
+                thread.join();
+            }
+
+            CHECK(calls == 1);
+            for (auto const &result : results) {
+                CHECK(result == std::optional{42});
+            }
+            auto const statistics = memoized.statistics();
+            CHECK(statistics.misses == 1);
+            CHECK(statistics.hits + statistics.shared == 7);
+        }
+    }
+
+    GIVEN("A function that throws") {
+
+        auto calls = 0;
+        auto const memoized = memoize<int>([&calls](int) -> std::optional<int> {
+            if (++calls == 1) {
+                throw std::runtime_error{"unavailable"};
+            }
+            return 42;
+        });
+
+        THEN("propagate the exception, and call the function again the next time") {
+            CHECK_THROWS_AS(memoized(1), std::runtime_error);
+            CHECK(memoized(1) == std::optional{42});
+            CHECK(calls == 2);
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#include <absent/support/optional_ref.h>
+
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::support;
+
+SCENARIO("optional_ref<T> is a non-owning nullable reference", "[optional_ref]") {
+
+    GIVEN("An optional_ref<string>") {
+
+        THEN("be as small as a pointer, trivially copyable, and not constructible from a temporary") {
+            STATIC_REQUIRE(sizeof(optional_ref<std::string>) == sizeof(std::string *));
+            STATIC_REQUIRE(std::is_trivially_copyable_v<optional_ref<std::string>>);
+            STATIC_REQUIRE_FALSE(std::is_constructible_v<optional_ref<std::string const>, std::string &&>);
+        }
+
+        WHEN("empty") {
+            optional_ref<std::string> const none;
+
+            THEN("not refer to any object") {
+                CHECK_FALSE(none.has_value());
+                CHECK(none.to_optional() == std::nullopt);
+            }
+        }
+
+        WHEN("referring to a string") {
+            std::string text{"42"};
+            optional_ref<std::string> const some{text};
+
+            THEN("refer to the very same string") {
+                CHECK(&*some == &text);
+                CHECK(some->size() == 2);
+                CHECK(some.to_optional() == std::optional<std::string>{"42"});
+                CHECK(optional_ref<std::string const>{some} == optional_ref<std::string const>{text});
+            }
+        }
+    }
+}
@@ -0,0 +1,177 @@
+#include <absent/and_then.h>
+#include <absent/lift.h>
+#include <absent/parsing.h>
+#include <absent/transform.h>
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace std::string_view_literals;
+
+SCENARIO("integer parses a whole text as an integer without throwing", "[parsing]") {
+
+    GIVEN("A parser for int") {
+
+        auto const to_int = parsing::integer<int>();
+
+        THEN("parse integers") {
+            CHECK(to_int("42") == std::optional{42});
+            CHECK(to_int("-7") == std::optional{-7});
+        }
+
+        THEN("reject texts that aren't made only of an integer") {
+            CHECK(to_int("") == std::nullopt);
+            CHECK(to_int("abc") == std::nullopt);
+            CHECK(to_int(" 42") == std::nullopt);
+            CHECK(to_int("42abc") == std::nullopt);
+            CHECK(to_int("4.2") == std::nullopt);
+        }
+
+        THEN("reject integers that don't fit") {
+            CHECK(to_int("99999999999") == std::nullopt);
+        }
+    }
+
+    GIVEN("A parser for uint8_t in base 16") {
+
+        auto const to_byte = parsing::integer<std::uint8_t>(16);
+
+        THEN("parse hexadecimal integers") {
+            CHECK(to_byte("ff") == std::optional<std::uint8_t>{255});
+            CHECK(to_byte("100") == std::nullopt);
+            CHECK(to_byte("-1") == std::nullopt);
+        }
+    }
+}
+
+SCENARIO("floating parses a whole text as a floating point number without throwing", "[parsing]") {
+
+    GIVEN("A parser for double") {
+
+        auto const to_double = parsing::floating<double>();
+
+        THEN("parse numbers in fixed and scientific notation") {
+            CHECK(to_double("3.5") == std::optional{3.5});
+            CHECK(to_double("-2.5e2") == std::optional{-250.0});
+        }
+
+        THEN("reject texts that aren't made only of a number") {
+            CHECK(to_double("") == std::nullopt);
+            CHECK(to_double("3.5kg") == std::nullopt);
+            CHECK(to_double("1e999") == std::nullopt);
+        }
+    }
+
+    GIVEN("A parser for double in fixed notation") {
+
+        auto const to_double = parsing::floating<double>(std::chars_format::fixed);
+
+        THEN("stop at the exponent") {
+            CHECK(to_double("2.5") == std::optional{2.5});
+            CHECK(to_double("2.5e2") == std::nullopt);
+        }
+    }
+}
+
+SCENARIO("field, fields, and key_value split a text without copying it", "[parsing]") {
+
+    GIVEN("A record of three fields") {
+
+        auto const record = "42,3.5,joe"sv;
+
+        WHEN("extracting a field") {
+
+            THEN("refer into the record") {
+                auto const second = parsing::field(1)(record);
+                CHECK(second == std::optional{"3.5"sv});
+                CHECK(second->data() == record.data() + 3);
+                CHECK(parsing::field(0)(record) == std::optional{"42"sv});
+                CHECK(parsing::field(2)(record) == std::optional{"joe"sv});
+            }
+
+            THEN("return an empty optional when the field is missing") {
+                CHECK(parsing::field(3)(record) == std::nullopt);
+            }
+        }
+
+        WHEN("splitting it into fields") {
+
+            THEN("return exactly as many fields as expected") {
+                CHECK(parsing::fields<3>()(record) == std::optional{std::array{"42"sv, "3.5"sv, "joe"sv}});
+                CHECK(parsing::fields<2>()(record) == std::nullopt);
+                CHECK(parsing::fields<4>()(record) == std::nullopt);
+            }
+        }
+    }
+
+    GIVEN("A key/value pair") {
+
+        THEN("split at the first separator") {
+            CHECK(parsing::key_value()("timeout=30"sv) == std::optional{std::pair{"timeout"sv, "30"sv}});
+            CHECK(parsing::key_value(':')("url:http://host"sv) == std::optional{std::pair{"url"sv, "http://host"sv}});
+            CHECK(parsing::key_value()("timeout"sv) == std::nullopt);
+        }
+    }
+}
+
+SCENARIO("parsers compose with and_then, transform, and lift", "[parsing]") {
+
+    struct order final {
+        int quantity;
+        double price;
+
+        auto operator==(order const &other) const -> bool {
+            return quantity == other.quantity && price == other.price;
+        }
+    };
+
+    auto const to_order = [](std::array<std::string_view, 2> const &columns) {
+        return lift([](int quantity, double price) { return order{quantity, price}; })(
+            parsing::integer<int>()(columns[0]), parsing::floating<double>()(columns[1]));
+    };
+
+    GIVEN("Lines of a buffer") {
+
+        auto const buffer = "2;9.5\nx;1.0\n"sv;
+        auto const first = std::optional{buffer.substr(0, buffer.find('\n'))};
+        auto const second = std::optional{buffer.substr(buffer.find('\n') + 1, 5)};
+
+        WHEN("parsing a valid line") {
+            auto const parsed = first >> parsing::fields<2>(';') >> to_order;
+
+            THEN("return the record") {
+                CHECK(parsed == std::optional{order{2, 9.5}});
+            }
+        }
+
+        WHEN("parsing an invalid line") {
+            auto const parsed = second >> parsing::fields<2>(';') >> to_order;
+
+            THEN("return an empty optional") {
+                CHECK(parsed == std::nullopt);
+            }
+        }
+    }
+
+    GIVEN("A line of key/value pairs") {
+
+        auto const line = std::optional{"quantity=2;price=9.5"sv};
+
+        WHEN("parsing the value of a pair") {
+            auto const price = line >> parsing::field(1, ';') >> parsing::key_value() |
+                               [](auto const &kv) { return kv.second; };
+
+            THEN("return the value") {
+                CHECK(price == std::optional{"9.5"sv});
+                CHECK((price >> parsing::floating<double>()) == std::optional{9.5});
+            }
+        }
+    }
+}
@@ -0,0 +1,162 @@
+#include <absent/parsing.h>
+#include <absent/ranges.h>
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+using namespace std::string_view_literals;
+
+namespace {
+
+template <typename Range>
+auto to_vector(Range &&range) {
+    auto values = std::vector<std::decay_t<decltype(*range.begin())>>{};
+    for (auto &&value : range) {
+        values.push_back(value);
+    }
+    return values;
+}
+
+}
+
+SCENARIO("present provides a lazy view of the values inside the non-empty nullables of a range", "[ranges]") {
+
+    GIVEN("A vector<optional<int>>") {
+
+        auto nullables = std::vector<std::optional<int>>{1, std::nullopt, 3, std::nullopt};
+
+        WHEN("viewing its present values") {
+            auto values = nullables | views::present();
+
+            THEN("skip the empty ones") {
+                CHECK(to_vector(values) == std::vector{1, 3});
+            }
+
+            THEN("refer to the values inside the vector") {
+                for (auto &value : values) {
+                    value *= 10;
+                }
+                CHECK(nullables == std::vector<std::optional<int>>{10, std::nullopt, 30, std::nullopt});
+            }
+        }
+
+        WHEN("it's an rvalue") {
+            auto values = std::move(nullables) | views::present();
+
+            THEN("own it") {
+                CHECK(to_vector(values) == std::vector{1, 3});
+            }
+        }
+
+        WHEN("all of them are empty") {
+            auto const empties = std::vector<std::optional<int>>(3);
+
+            THEN("return an empty view") {
+                CHECK(to_vector(empties | views::present()).empty());
+            }
+        }
+    }
+}
+
+SCENARIO("transform_present provides a lazy view of the mapped values inside the non-empty nullables of a range",
+         "[ranges]") {
+
+    GIVEN("A vector<optional<int>> and a function int -> string") {
+
+        auto const nullables = std::vector<std::optional<int>>{1, std::nullopt, 3};
+        auto calls = 0;
+        auto const to_string = [&calls](int x) {
+            ++calls;
+            return std::to_string(x);
+        };
+
+        WHEN("viewing its mapped values") {
+            auto strings = nullables | views::transform_present(to_string);
+
+            THEN("map only the present values, and only when accessed") {
+                CHECK(calls == 0);
+                CHECK(to_vector(strings) == std::vector<std::string>{"1", "3"});
+                CHECK(calls == 2);
+            }
+        }
+    }
+}
+
+SCENARIO("and_then_each provides a lazy view of the values inside the non-empty nullables returned by a function",
+         "[ranges]") {
+
+    auto const half = [](int x) { return x % 2 == 0 ? std::optional{x / 2} : std::nullopt; };
+
+    GIVEN("A vector<string_view> and a parser string_view -> optional<int>") {
+
+        auto const texts = std::vector{"2"sv, "x"sv, "3"sv, ""sv, "8"sv};
+        auto calls = 0;
+        auto const to_int = [&calls](std::string_view text) {
+            ++calls;
+            return parsing::integer<int>()(text);
+        };
+
+        WHEN("viewing the parsed values") {
+            auto numbers = texts | views::and_then_each(to_int);
+
+            THEN("skip the texts that failed to parse, calling the parser once per text") {
+                CHECK(to_vector(numbers) == std::vector{2, 3, 8});
+                CHECK(calls == 5);
+            }
+        }
+
+        WHEN("chaining it with another and_then_each") {
+            auto halves = texts | views::and_then_each(to_int) | views::and_then_each(half);
+
+            THEN("apply the whole pipeline in a single pass") {
+                CHECK(to_vector(halves) == std::vector{1, 4});
+                CHECK(calls == 5);
+            }
+        }
+    }
+}
+
+#ifdef RVARAGO_ABSENT_HAS_RANGES
+
+SCENARIO("the views compose with the standard views", "[ranges]") {
+
+    auto const half = [](int x) { return x % 2 == 0 ? std::optional{x / 2} : std::nullopt; };
+
+    GIVEN("An unbounded sequence of integers") {
+
+        auto const naturals = std::views::iota(0);
+
+        WHEN("viewing the halves of the first even ones") {
+            auto halves = naturals | views::and_then_each(half) | std::views::take(3);
+
+            THEN("stop after taking them") {
+                STATIC_REQUIRE(std::ranges::input_range<decltype(halves)>);
+                CHECK(to_vector(halves) == std::vector{0, 1, 2});
+            }
+        }
+    }
+
+    GIVEN("A vector<optional<int>>") {
+
+        auto const nullables = std::vector<std::optional<int>>{1, std::nullopt, 3, std::nullopt, 5};
+
+        WHEN("viewing its present values") {
+            auto present = nullables | views::present();
+
+            THEN("be a forward view") {
+                STATIC_REQUIRE(std::ranges::view<decltype(present)>);
+                STATIC_REQUIRE(std::ranges::forward_range<decltype(present)>);
+                CHECK(std::ranges::equal(present | std::views::transform(half) | views::present(), std::vector<int>{}));
+                CHECK(std::ranges::count(present, 3) == 1);
+            }
+        }
+    }
+}
+
+#endif
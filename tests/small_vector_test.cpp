@@ -0,0 +1,111 @@
+#include <absent/support/small_vector.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::support;
+
+SCENARIO("small_vector<T, N> stores up to N elements inline", "[small_vector]") {
+
+    GIVEN("An empty small_vector<string, 2>") {
+
+        small_vector<std::string, 2> strings;
+
+        THEN("be empty and inline") {
+            CHECK(strings.empty());
+            CHECK(strings.is_inline());
+            CHECK(strings.capacity() == 2);
+        }
+
+        WHEN("appending up to N elements") {
+            strings.push_back("a");
+            strings.emplace_back(2, 'b');
+
+            THEN("keep them inline, in order") {
+                CHECK(strings.is_inline());
+                CHECK(strings.size() == 2);
+                CHECK(strings.front() == "a");
+                CHECK(strings.back() == "bb");
+            }
+        }
+
+        WHEN("appending more than N elements") {
+            strings.push_back("a");
+            strings.push_back("b");
+            strings.push_back(strings.front());
+
+            THEN("move them to the heap, in order") {
+                CHECK_FALSE(strings.is_inline());
+                CHECK(strings.capacity() >= 3);
+                CHECK(strings == small_vector<std::string, 2>{"a", "b", "a"});
+            }
+        }
+
+        WHEN("reserving more than N elements") {
+            strings.reserve(8);
+
+            THEN("allocate at once") {
+                CHECK_FALSE(strings.is_inline());
+                CHECK(strings.capacity() == 8);
+            }
+        }
+    }
+
+    GIVEN("A small_vector<unique_ptr<int>, 2>") {
+
+        small_vector<std::unique_ptr<int>, 2> pointers;
+        pointers.push_back(std::make_unique<int>(1));
+
+        WHEN("moving it while inline") {
+            auto moved = std::move(pointers);
+
+            THEN("move each element") {
+                CHECK(moved.size() == 1);
+                CHECK(*moved[0] == 1);
+                CHECK(pointers.empty());
+            }
+        }
+
+        WHEN("moving it while on the heap") {
+            pointers.push_back(std::make_unique<int>(2));
+            pointers.push_back(std::make_unique<int>(3));
+            auto const *const data = pointers.data();
+            auto moved = std::move(pointers);
+
+            THEN("move the buffer") {
+                CHECK(moved.data() == data);
+                CHECK(*moved[2] == 3);
+                CHECK(pointers.empty());
+                CHECK(pointers.is_inline());
+            }
+        }
+    }
+
+    GIVEN("A small_vector<string, 1> on the heap") {
+
+        small_vector<std::string, 1> const strings{"a", "b"};
+
+        WHEN("copying it") {
+            auto copy = strings;
+
+            THEN("copy the elements") {
+                CHECK(copy == strings);
+                CHECK(copy.data() != strings.data());
+            }
+        }
+
+        WHEN("clearing a copy of it") {
+            auto copy = strings;
+            copy.clear();
+
+            THEN("keep the capacity") {
+                CHECK(copy.empty());
+                CHECK(copy.capacity() >= 2);
+                CHECK(copy != strings);
+            }
+        }
+    }
+}
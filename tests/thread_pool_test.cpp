@@ -0,0 +1,30 @@
+#include <absent/support/thread_pool.h>
+
+#include <atomic>
+#include <memory>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+SCENARIO("thread_pool runs the submitted tasks on its workers", "[thread_pool]") {
+
+    GIVEN("A thread_pool with two workers") {
+
+        std::atomic<int> runs{0};
+
+        WHEN("destroyed after many tasks have been submitted") {
+            {
+                support::thread_pool pool{2};
+                CHECK(pool.size() == 2);
+                for (int i = 0; i < 1000; ++i) {
+                    pool.execute([&runs, owned = std::make_unique<int>(1)] { runs += *owned; });
+                }
+            }
+
+            THEN("run every task before joining the workers") {
+                CHECK(runs == 1000);
+            }
+        }
+    }
+}
@@ -0,0 +1,129 @@
+#include <absent/and_then.h>
+#include <absent/eval.h>
+#include <absent/for_each.h>
+#include <absent/fuse.h>
+#include <absent/transform.h>
+#include <absent/transform_ref.h>
+
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+namespace {
+
+struct address final {
+    std::string street;
+    std::vector<int> history;
+};
+
+struct person final {
+    std::string name;
+    address home;
+};
+
+}
+
+SCENARIO("transform_ref provides a way to project a reference out of optional<A> without copying", "[transform_ref]") {
+
+    GIVEN("An empty optional<person>") {
+
+        std::optional<person> const none;
+
+        THEN("return an empty optional_ref") {
+            CHECK_FALSE(project(none, &person::home).has_value());
+            CHECK_FALSE(transform_ref(none, [](person const &p) -> address const & { return p.home; }).has_value());
+        }
+    }
+
+    GIVEN("A non-empty optional<person>") {
+
+        std::optional<person> const some{person{"john", address{"main street", std::vector<int>(1024, 1)}}};
+
+        WHEN("projecting a member") {
+            support::optional_ref<address const> home = project(some, &person::home);
+
+            THEN("refer to the member of the wrapped person") {
+                CHECK(&*home == &some->home);
+            }
+        }
+
+        WHEN("projecting a nested member through a chain") {
+            support::optional_ref<std::string const> street = project(project(some, &person::home), &address::street);
+
+            THEN("refer to the nested member of the wrapped person") {
+                CHECK(&*street == &some->home.street);
+            }
+        }
+
+        WHEN("chaining with and_then, eval and for_each") {
+            auto const non_empty_street = [](address const &home) {
+                return home.street.empty() ? support::optional_ref<std::string const>{}
+                                           : support::optional_ref<std::string const>{home.street};
+            };
+            auto const street = project(some, &person::home) >> non_empty_street;
+
+            THEN("keep referring to the wrapped person") {
+                std::string const *visited = nullptr;
+                for_each(street, [&visited](std::string const &s) { visited = &s; });
+                CHECK(visited == &some->home.street);
+                CHECK(eval(street, [] { return std::string{"unknown"}; }) == "main street");
+            }
+        }
+    }
+
+    GIVEN("A mutable person") {
+
+        std::optional<person> some{person{"john", address{"main street", {}}}};
+
+        THEN("allow the wrapped person to be modified via an optional_ref<person>") {
+            support::optional_ref<person> const ref{*some};
+            auto name = project(ref, &person::name);
+            STATIC_REQUIRE(std::is_same_v<decltype(name), support::optional_ref<std::string>>);
+            *name = "jane";
+            CHECK(some->name == "jane");
+        }
+
+        AND_WHEN("projecting a member of the mutable optional<person> directly") {
+
+            auto name = project(some, &person::name);
+            STATIC_REQUIRE(std::is_same_v<decltype(name), support::optional_ref<std::string>>);
+            *name = "jane";
+
+            THEN("modify the wrapped person") {
+                CHECK(some->name == "jane");
+            }
+        }
+
+        AND_WHEN("chaining a prvalue optional_ref<string> projected from it") {
+
+            support::optional_ref<person> const ref{*some};
+            auto const fallback = [] { return std::string{"fallback"}; };
+            auto const identity = [](std::string name) { return name; };
+            auto const wrap = [](std::string name) { return std::optional{std::move(name)}; };
+
+            THEN("copy the referred name, and leave it untouched") {
+                CHECK(eval(project(ref, &person::name), fallback) == "john");
+                CHECK(some->name == "john");
+
+                std::string seen;
+                for_each(project(ref, &person::name), [&seen](std::string name) { seen = std::move(name); });
+                CHECK(seen == "john");
+                CHECK(some->name == "john");
+
+                CHECK((project(ref, &person::name) | identity) == std::optional<std::string>{"john"});
+                CHECK(some->name == "john");
+
+                CHECK((project(ref, &person::name) >> wrap) == std::optional<std::string>{"john"});
+                CHECK(some->name == "john");
+
+                CHECK((project(ref, &person::name) | (fuse() | identity)) == std::optional<std::string>{"john"});
+                CHECK(some->name == "john");
+            }
+        }
+    }
+}
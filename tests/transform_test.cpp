@@ -1,5 +1,6 @@
 #include <absent/transform.h>
 
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -64,4 +65,26 @@ SCENARIO("transform provides a way to map {optional<A>, f: A -> B} to optional<B
             }
         }
     }
+
+    GIVEN("A function unique_ptr<int> -> int that takes ownership of its argument") {
+
+        auto release = [](std::unique_ptr<int> p) { return *p; };
+
+        AND_GIVEN("An rvalue optional<unique_ptr<int>>") {
+
+            WHEN("empty") {
+                THEN("return a new empty optional<int>") {
+                    std::optional<int> mapped_none = std::optional<std::unique_ptr<int>>{} | release;
+                    CHECK(mapped_none == std::nullopt);
+                }
+            }
+
+            WHEN("not empty") {
+                THEN("move the wrapped value into the function and return a non-empty and mapped optional<int>") {
+                    std::optional<int> mapped_some = std::optional{std::make_unique<int>(200)} | release;
+                    CHECK(mapped_some == std::optional{200});
+                }
+            }
+        }
+    }
 }
@@ -0,0 +1,34 @@
+#include <absent/adapters/validated/and_then.h>
+
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::adapters::validated;
+
+SCENARIO("and_then chains a dependent check after a validated<A, E, N>", "[validated][and_then]") {
+
+    auto const half_of_even = [](int x) {
+        return x % 2 == 0 ? types::validated<int, std::string>{x / 2}
+                          : types::validated<int, std::string>{types::in_place_error, "odd"};
+    };
+
+    GIVEN("A validated<int, string> holding a value") {
+
+        THEN("apply the check to the value") {
+            CHECK(and_then(types::validated<int, std::string>{42}, half_of_even) ==
+                  types::validated<int, std::string>{21});
+            CHECK((types::validated<int, std::string>{21} >> half_of_even).errors().front() == "odd");
+        }
+    }
+
+    GIVEN("A validated<int, string> holding errors") {
+
+        types::validated<int, std::string> const invalid{types::in_place_error, "negative"};
+
+        THEN("keep the errors without applying the check") {
+            CHECK((invalid >> half_of_even) == invalid);
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#include <absent/adapters/either/parsing.h>
+#include <absent/adapters/validated/lift.h>
+
+#include <string>
+#include <string_view>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::adapters::validated;
+
+SCENARIO("lift applies a function to independent validated<Ai, E, N> by accumulating their errors",
+         "[validated][lift]") {
+
+    struct user final {
+        std::string name;
+        int age;
+
+        auto operator==(user const &other) const -> bool {
+            return name == other.name && age == other.age;
+        }
+    };
+
+    auto const name_of = [](std::string_view name) {
+        return name.empty() ? types::validated<std::string, std::string>{types::in_place_error, "empty name"}
+                            : types::validated<std::string, std::string>{types::in_place_value, name};
+    };
+
+    auto const age_of = [](int age) {
+        return age < 0 ? types::validated<int, std::string>{types::in_place_error, "negative age"}
+                       : types::validated<int, std::string>{age};
+    };
+
+    auto const to_user = lift([](std::string name, int age) { return user{std::move(name), age}; });
+
+    GIVEN("Valid fields") {
+
+        THEN("return the user") {
+            CHECK(*to_user(name_of("joe"), age_of(42)) == user{"joe", 42});
+        }
+    }
+
+    GIVEN("Invalid fields") {
+
+        THEN("return all the errors") {
+            CHECK(to_user(name_of(""), age_of(-1)).errors() ==
+                  types::validated<user, std::string>::errors_type{"empty name", "negative age"});
+            CHECK(to_user(name_of("joe"), age_of(-1)).errors().size() == 1);
+        }
+    }
+
+    GIVEN("Checks that return either<A, E>") {
+
+        auto const to_pair = lift([](int x, int y) { return x + y; });
+
+        THEN("convert them with from_either and accumulate their errors") {
+            auto const sum = to_pair(from_either(either::parsing::integer<int>()("x")),
+                                     from_either(either::parsing::integer<int>()("1.5")));
+            CHECK(sum.errors() == types::validated<int, either::parsing::error>::errors_type{
+                                      either::parsing::error::invalid_number,
+                                      either::parsing::error::trailing_characters});
+            CHECK(*to_pair(from_either(either::parsing::integer<int>()("1")),
+                           from_either(either::parsing::integer<int>()("2"))) == 3);
+        }
+    }
+}
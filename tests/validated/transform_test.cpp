@@ -0,0 +1,34 @@
+#include <absent/adapters/validated/transform.h>
+
+#include <string>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::adapters::validated;
+
+SCENARIO("transform maps the value of a validated<A, E, N>", "[validated][transform]") {
+
+    auto const to_string = [](int x) { return std::to_string(x); };
+
+    GIVEN("A validated<int, string> holding a value") {
+
+        types::validated<int, std::string> const valid = 42;
+        types::validated<std::string, std::string> const expected{types::in_place_value, "42"};
+
+        THEN("map the value") {
+            CHECK(transform(valid, to_string) == expected);
+            CHECK((valid | to_string) == expected);
+        }
+    }
+
+    GIVEN("A validated<int, string> holding errors") {
+
+        types::validated<int, std::string> invalid{types::validated<int, std::string>::errors_type{"negative", "odd"}};
+
+        THEN("keep the errors") {
+            CHECK(transform(invalid, to_string).errors() == invalid.errors());
+            CHECK((std::move(invalid) | to_string).errors().size() == 2);
+        }
+    }
+}
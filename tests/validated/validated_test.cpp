@@ -0,0 +1,87 @@
+#include <absent/adapters/either/either.h>
+#include <absent/adapters/validated/validated.h>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters;
+
+SCENARIO("validated<A, E, N> holds either a value of type A or errors of type E", "[validated]") {
+
+    using checked_int = types::validated<int, std::string>;
+
+    GIVEN("A validated<int, string>") {
+
+        WHEN("holding a value") {
+            checked_int const valid = 42;
+
+            THEN("give unchecked access to the value") {
+                CHECK(valid.has_value());
+                CHECK(*valid == 42);
+            }
+        }
+
+        WHEN("holding an error") {
+            checked_int const invalid = std::string{"negative"};
+
+            THEN("give unchecked access to the errors, stored inline") {
+                CHECK_FALSE(invalid.has_value());
+                CHECK(invalid.errors() == checked_int::errors_type{"negative"});
+                CHECK(invalid.errors().is_inline());
+            }
+        }
+
+        WHEN("holding several errors") {
+            checked_int const invalid{checked_int::errors_type{"negative", "odd"}};
+
+            THEN("keep them in order") {
+                CHECK(invalid.errors().size() == 2);
+                CHECK(invalid.errors()[1] == "odd");
+            }
+        }
+
+        THEN("compare by value or by errors") {
+            CHECK(checked_int{42} == checked_int{42});
+            CHECK(checked_int{42} != checked_int{std::string{"negative"}});
+            CHECK(checked_int{types::in_place_error, "odd"} == checked_int{types::in_place_error, "odd"});
+        }
+    }
+
+    GIVEN("A validated<string, string> where A and E are the same type") {
+
+        types::validated<std::string, std::string> const valid{types::in_place_value, "42"};
+        types::validated<std::string, std::string> const invalid{types::in_place_error, "empty"};
+
+        THEN("hold a value or an error as requested") {
+            CHECK(*valid == "42");
+            CHECK(invalid.errors().front() == "empty");
+        }
+    }
+
+    GIVEN("A validated<string, vector<int>> whose error is only explicitly constructible from an int") {
+
+        THEN("not convert implicitly from an int") {
+            STATIC_REQUIRE_FALSE(std::is_convertible_v<int, types::validated<std::string, std::vector<int>>>);
+            STATIC_REQUIRE(std::is_convertible_v<char const *, types::validated<std::string, std::vector<int>>>);
+        }
+    }
+}
+
+SCENARIO("from_either converts an either<A, E> into a validated<A, E, N>", "[validated]") {
+
+    GIVEN("Eithers holding a value and an error") {
+
+        types::either<int, std::string> const valid = 42;
+        types::either<int, std::string> const invalid = std::string{"negative"};
+
+        THEN("keep the value or the error") {
+            CHECK(validated::from_either(valid) == types::validated<int, std::string>{42});
+            CHECK(validated::from_either(invalid).errors().front() == "negative");
+            STATIC_REQUIRE(std::is_same_v<decltype(validated::from_either<2>(types::either<int, std::string>{42})),
+                                          types::validated<int, std::string, 2>>);
+        }
+    }
+}
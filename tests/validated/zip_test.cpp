@@ -0,0 +1,57 @@
+#include <absent/adapters/validated/zip.h>
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent::adapters;
+using namespace rvarago::absent::adapters::validated;
+
+SCENARIO("zip combines independent validated<Ai, E, N> by accumulating their errors", "[validated][zip]") {
+
+    GIVEN("validated holding values") {
+
+        types::validated<int, std::string> const id = 42;
+        types::validated<std::string, std::string> const name{types::in_place_value, "joe"};
+
+        THEN("return the tuple of the values") {
+            CHECK(*zip(id, name) == std::tuple{42, std::string{"joe"}});
+        }
+    }
+
+    GIVEN("validated where some hold errors") {
+
+        types::validated<int, std::string> const id{types::in_place_error, "negative id"};
+        types::validated<std::string, std::string> const name{types::in_place_value, "joe"};
+        types::validated<int, std::string> const age{types::validated<int, std::string>::errors_type{"old", "odd"}};
+
+        THEN("return all the errors, in order") {
+            CHECK(zip(id, name, age).errors() ==
+                  types::validated<int, std::string>::errors_type{"negative id", "old", "odd"});
+        }
+    }
+
+    GIVEN("validated with more errors than fit inline") {
+
+        types::validated<int, std::string, 2> const first{types::validated<int, std::string, 2>::errors_type{"a", "b"}};
+        types::validated<int, std::string, 2> const second{types::in_place_error, "c"};
+
+        THEN("move them to the heap") {
+            auto const zipped = zip(first, second);
+            CHECK_FALSE(zipped.errors().is_inline());
+            CHECK(zipped.errors() == types::validated<int, std::string, 2>::errors_type{"a", "b", "c"});
+        }
+    }
+
+    GIVEN("rvalue validated of move-only types") {
+
+        THEN("move the values out of them") {
+            auto zipped = zip(types::validated<std::unique_ptr<int>, std::string>{std::make_unique<int>(42)},
+                              types::validated<int, std::string>{1});
+            CHECK(*std::get<0>(*zipped) == 42);
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#include <absent/support/work_stealing_pool.h>
+#include <absent/when_all.h>
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+SCENARIO("when_all provides a way to run nullary functions returning optional<A> concurrently", "[when_all]") {
+
+    support::work_stealing_pool pool{4};
+
+    auto const profile = [] { return std::optional<std::string>{"profile"}; };
+    auto const quota = [] { return std::optional<int>{42}; };
+
+    GIVEN("Functions that all return non-empty optionals") {
+
+        THEN("return a future of an optional wrapping the tuple of their values") {
+            std::optional<std::tuple<std::string, int>> all = when_all(pool, profile, quota).get();
+            CHECK(all == std::optional{std::tuple{std::string{"profile"}, 42}});
+        }
+    }
+
+    GIVEN("A function that returns an empty optional and a function that waits for cancellation") {
+
+        std::atomic<bool> is_started{false};
+        std::atomic<bool> is_cancelled{false};
+        auto const permissions = [&is_started] {
+            while (!is_started) {
+                std::this_thread::yield();
+            }
+            return std::optional<bool>{};
+        };
+        auto const slow = [&is_started, &is_cancelled](support::cancellation_token const &token) {
+            is_started = true;
+            while (!token.is_cancelled()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            }
+            is_cancelled = true;
+            return std::optional<int>{0};
+        };
+
+        THEN("return a future of an empty optional, and cancel the remaining function") {
+            std::optional<std::tuple<int, bool>> all = when_all(pool, slow, permissions).get();
+            CHECK(all == std::nullopt);
+
+            while (!is_cancelled) {
+                std::this_thread::yield();
+            }
+            CHECK(is_cancelled);
+        }
+    }
+
+    GIVEN("A function that throws an exception") {
+
+        auto const failing = []() -> std::optional<int> { throw std::runtime_error{"404"}; };
+
+        THEN("return a future that rethrows the exception") {
+            auto all = when_all(pool, quota, failing);
+            CHECK_THROWS_AS(all.get(), std::runtime_error);
+        }
+    }
+
+    GIVEN("Many concurrent fan-outs") {
+
+        constexpr int fan_outs = 1000;
+        std::atomic<int> calls{0};
+
+        THEN("complete all of them") {
+            std::vector<support::future<std::optional<std::tuple<int, int, int>>>> results;
+            for (int i = 0; i < fan_outs; ++i) {
+                auto const branch = [&calls, i] {
+                    ++calls;
+                    return std::optional{i};
+                };
+                results.push_back(when_all(pool, branch, branch, branch));
+            }
+            for (int i = 0; i < fan_outs; ++i) {
+                CHECK(results[static_cast<std::size_t>(i)].get() == std::optional{std::tuple{i, i, i}});
+            }
+            CHECK(calls == 3 * fan_outs);
+        }
+    }
+}
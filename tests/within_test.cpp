@@ -0,0 +1,110 @@
+#include <absent/and_then.h>
+#include <absent/within.h>
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include "manual_clock.h"
+
+using namespace rvarago::absent;
+using rvarago::absent::tests::manual_clock;
+
+namespace {
+
+using deadline = support::basic_deadline<manual_clock>;
+
+template <typename Deadline, typename = void>
+struct is_within_viable : std::false_type {};
+
+template <typename Deadline>
+struct is_within_viable<Deadline, std::void_t<decltype(within(std::declval<Deadline>(), std::declval<int (*)(int)>()))>>
+    : std::true_type {};
+
+}
+
+SCENARIO("within provides a way to skip the stages of a pipeline of optionals once a deadline expires", "[within]") {
+
+    manual_clock::current = manual_clock::time_point{};
+    auto const budget = deadline::after(std::chrono::milliseconds{100});
+
+    auto calls = 0;
+    auto const find_person = [&calls](int id) {
+        ++calls;
+        manual_clock::current += std::chrono::milliseconds{60};
+        return std::optional{std::to_string(id)};
+    };
+    auto const find_address = [&calls](std::string const &person) {
+        ++calls;
+        return std::optional{person + "'s address"};
+    };
+
+    GIVEN("A pipeline whose stages fit in the budget") {
+
+        THEN("run all the stages") {
+            auto const find_quota = [&calls](std::string const &person) {
+                ++calls;
+                return std::optional{person.size()};
+            };
+            CHECK((std::optional{42} >> within(budget, find_person) >> within(budget, find_quota)) ==
+                  std::optional<std::size_t>{2});
+            CHECK(calls == 2);
+        }
+    }
+
+    GIVEN("A pipeline whose budget is spent by a stage") {
+
+        THEN("skip the remaining stages, and return an empty optional") {
+            auto const slow = [&calls](std::string const &person) {
+                ++calls;
+                manual_clock::current += std::chrono::milliseconds{60};
+                return std::optional{person};
+            };
+            CHECK((std::optional{42} >> within(budget, find_person) >> within(budget, slow) >>
+                   within(budget, find_address)) == std::nullopt);
+            CHECK(calls == 2);
+        }
+    }
+
+    GIVEN("A stage that accepts the deadline") {
+
+        THEN("pass it the remaining budget") {
+            auto const with_budget = [](std::string const &person, deadline const &d) {
+                return std::optional{person + " within " + std::to_string(d.remaining().count()) + "ms"};
+            };
+            CHECK((std::optional{42} >> within(budget, find_person) >> within(budget, with_budget)) ==
+                  std::optional<std::string>{"42 within 40ms"});
+        }
+    }
+
+    GIVEN("A temporary deadline") {
+
+        THEN("reject it, since the returned function would outlive it") {
+            STATIC_REQUIRE(is_within_viable<deadline const &>::value);
+            STATIC_REQUIRE_FALSE(is_within_viable<deadline>::value);
+            STATIC_REQUIRE_FALSE(is_within_viable<deadline const>::value);
+        }
+    }
+
+    GIVEN("A stage of transform, which returns a plain value") {
+
+        auto const twice = [&calls](int x) {
+            ++calls;
+            return x * 2;
+        };
+
+        THEN("skip it once the deadline has expired, and return an empty optional rather than a made-up value") {
+            manual_clock::current += std::chrono::milliseconds{100};
+            CHECK((std::optional{21} >> transform_within<std::optional>(budget, twice)) == std::nullopt);
+            CHECK(calls == 0);
+        }
+
+        THEN("run it while the deadline has not expired") {
+            CHECK((std::optional{21} >> transform_within<std::optional>(budget, twice)) == std::optional{42});
+            CHECK(calls == 1);
+        }
+    }
+}
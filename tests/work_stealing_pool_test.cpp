@@ -0,0 +1,41 @@
+#include <absent/support/work_stealing_pool.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+SCENARIO("work_stealing_pool runs the submitted tasks on its workers", "[work_stealing_pool]") {
+
+    GIVEN("A work_stealing_pool with four workers") {
+
+        std::atomic<int> runs{0};
+
+        WHEN("destroyed after many tasks have been submitted, including tasks submitted by other tasks") {
+            {
+                std::function<void(int)> spawn;
+                support::work_stealing_pool pool{4};
+                CHECK(pool.size() == 4);
+
+                spawn = [&](int depth) {
+                    ++runs;
+                    if (depth > 0) {
+                        pool.execute([&spawn, depth] { spawn(depth - 1); });
+                        pool.execute([&spawn, depth] { spawn(depth - 1); });
+                    }
+                };
+                pool.execute([&spawn] { spawn(9); });
+                for (int i = 0; i < 1000; ++i) {
+                    pool.execute([&runs, owned = std::make_unique<int>(1)] { runs += *owned; });
+                }
+            }
+
+            THEN("run every task before joining the workers") {
+                CHECK(runs == 1000 + (1 << 10) - 1);
+            }
+        }
+    }
+}
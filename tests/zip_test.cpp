@@ -0,0 +1,52 @@
+#include <absent/zip.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include <catch2/catch.hpp>
+
+using namespace rvarago::absent;
+
+SCENARIO("zip provides a way to combine several optional<A> into an optional<tuple<A...>>", "[zip]") {
+
+    GIVEN("An optional<int>, an optional<string>, and an optional<double>") {
+
+        std::optional<int> const some_int{42};
+        std::optional<std::string> const some_string{"42"};
+        std::optional<double> const some_double{4.2};
+
+        WHEN("none is empty") {
+            THEN("return a new optional wrapping the tuple of their values") {
+                std::optional<std::tuple<int, std::string, double>> zipped = zip(some_int, some_string, some_double);
+                CHECK(zipped == std::optional{std::tuple{42, std::string{"42"}, 4.2}});
+            }
+        }
+
+        WHEN("any is empty") {
+            std::optional<std::string> const none;
+
+            THEN("return a new empty optional") {
+                std::optional<std::tuple<int, std::string, double>> zipped = zip(some_int, none, some_double);
+                CHECK(zipped == std::nullopt);
+            }
+        }
+    }
+
+    GIVEN("Rvalue optional<unique_ptr<int>>") {
+
+        THEN("move the wrapped values into the tuple") {
+            auto zipped = zip(std::optional{std::make_unique<int>(1)}, std::optional{std::make_unique<int>(2)});
+            CHECK(*std::get<0>(*zipped) == 1);
+            CHECK(*std::get<1>(*zipped) == 2);
+        }
+    }
+
+    GIVEN("Constant expressions") {
+
+        THEN("be evaluated at compile-time") {
+            STATIC_REQUIRE(zip(std::optional{1}, std::optional{2}) == std::optional{std::tuple{1, 2}});
+        }
+    }
+}